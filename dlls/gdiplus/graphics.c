@@ -420,6 +420,37 @@ static GpStatus alpha_blend_bmp_pixels(GpGraphics *graphics, INT dst_x, INT dst_
     INT x, y;
     CompositingMode comp_mode = graphics->compmode;
 
+    /* fast path for the common 32bpp ARGB destination, avoiding the
+     * per-pixel Get/SetPixel calls */
+    if (dst_bitmap->format == PixelFormat32bppARGB && dst_bitmap->bits
+            && dst_x >= 0 && dst_y >= 0
+            && dst_x + src_width <= dst_bitmap->width && dst_y + src_height <= dst_bitmap->height)
+    {
+        for (y=0; y<src_height; y++)
+        {
+            const ARGB *src_row = (const ARGB *)(src + src_stride * y);
+            ARGB *dst_row = (ARGB *)(dst_bitmap->bits + dst_bitmap->stride * (y + dst_y)) + dst_x;
+
+            for (x=0; x<src_width; x++)
+            {
+                ARGB src_color = src_row[x];
+
+                if (comp_mode == CompositingModeSourceCopy)
+                    dst_row[x] = (src_color & 0xff000000) ? src_color : 0;
+                else
+                {
+                    if (!(src_color & 0xff000000))
+                        continue;
+                    if (fmt & PixelFormatPAlpha)
+                        dst_row[x] = color_over_fgpremult(dst_row[x], src_color);
+                    else
+                        dst_row[x] = color_over(dst_row[x], src_color);
+                }
+            }
+        }
+        return Ok;
+    }
+
     for (y=0; y<src_height; y++)
     {
         for (x=0; x<src_width; x++)
@@ -495,10 +495,11 @@ BOOL WINAPI DECLSPEC_HOTPATCH AreFileApisANSI(void)
 BOOL WINAPI CopyFileExW( const WCHAR *source, const WCHAR *dest, LPPROGRESS_ROUTINE progress,
                          void *param, BOOL *cancel_ptr, DWORD flags )
 {
-    static const int buffer_size = 65536;
+    static const int buffer_size = 1024 * 1024;
     HANDLE h1, h2;
     FILE_BASIC_INFORMATION info;
     IO_STATUS_BLOCK io;
+    LARGE_INTEGER size;
     DWORD count;
     BOOL ret = FALSE;
     char *buffer;
@@ -524,7 +525,7 @@ BOOL WINAPI CopyFileExW( const WCHAR *source, const WCHAR *dest, LPPROGRESS_ROUT
         FIXME("COPY_FILE_OPEN_SOURCE_FOR_WRITE is not supported\n");
 
     if ((h1 = CreateFileW( source, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
-                           NULL, OPEN_EXISTING, 0, 0 )) == INVALID_HANDLE_VALUE)
+                           NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0 )) == INVALID_HANDLE_VALUE)
     {
         WARN("Unable to open source %s\n", debugstr_w(source));
         HeapFree( GetProcessHeap(), 0, buffer );
@@ -567,6 +568,14 @@ BOOL WINAPI CopyFileExW( const WCHAR *source, const WCHAR *dest, LPPROGRESS_ROUT
         return FALSE;
     }
 
+    /* preallocate the destination to reduce fragmentation; ignore failures */
+    if (GetFileSizeEx( h1, &size ) && size.QuadPart)
+    {
+        FILE_END_OF_FILE_INFORMATION eof;
+        eof.EndOfFile = size;
+        NtSetInformationFile( h2, &io, &eof, sizeof(eof), FileEndOfFileInformation );
+    }
+
     while (ReadFile( h1, buffer, buffer_size, &count, NULL ) && count)
     {
         char *p = buffer;
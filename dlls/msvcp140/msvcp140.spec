@@ -3780,4 +3780,10 @@
 @ cdecl __crtSetThreadpoolWait(ptr long ptr) MSVCP__crtSetThreadpoolWait
 @ cdecl __crtWaitForThreadpoolTimerCallbacks(ptr long) MSVCP__crtWaitForThreadpoolTimerCallbacks
 @ stub __set_stl_sync_api_mode
+@ stdcall __std_bulk_submit_threadpool_work(ptr long) __std_bulk_submit_threadpool_work
+@ stdcall __std_close_threadpool_work(ptr) __std_close_threadpool_work
+@ stdcall __std_create_threadpool_work(ptr ptr ptr) __std_create_threadpool_work
+@ stdcall __std_parallel_algorithms_hw_threads() __std_parallel_algorithms_hw_threads
+@ stdcall __std_submit_threadpool_work(ptr) __std_submit_threadpool_work
+@ stdcall __std_wait_for_threadpool_work_callbacks(ptr long) __std_wait_for_threadpool_work_callbacks
 @ cdecl xtime_get(ptr long) xtime_get
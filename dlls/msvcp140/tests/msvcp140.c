@@ -195,6 +195,12 @@ enum file_type {
 };
 
 static unsigned int (__cdecl *p__Thrd_id)(void);
+static unsigned int (__stdcall *p__std_parallel_algorithms_hw_threads)(void);
+static PTP_WORK (__stdcall *p__std_create_threadpool_work)(PTP_WORK_CALLBACK,void*,PTP_CALLBACK_ENVIRON);
+static void (__stdcall *p__std_submit_threadpool_work)(PTP_WORK);
+static void (__stdcall *p__std_bulk_submit_threadpool_work)(PTP_WORK,size_t);
+static void (__stdcall *p__std_close_threadpool_work)(PTP_WORK);
+static void (__stdcall *p__std_wait_for_threadpool_work_callbacks)(PTP_WORK,int);
 static MSVCP_bool (__cdecl *p__Task_impl_base__IsNonBlockingThread)(void);
 static task_continuation_context* (__thiscall *p_task_continuation_context_ctor)(task_continuation_context*);
 static void (__thiscall *p__ContextCallback__Assign)(_ContextCallback*, void*);
@@ -269,6 +275,12 @@ static BOOL init(void)
     }
 
     SET(p__Thrd_id, "_Thrd_id");
+    SET(p__std_parallel_algorithms_hw_threads, "__std_parallel_algorithms_hw_threads");
+    SET(p__std_create_threadpool_work, "__std_create_threadpool_work");
+    SET(p__std_submit_threadpool_work, "__std_submit_threadpool_work");
+    SET(p__std_bulk_submit_threadpool_work, "__std_bulk_submit_threadpool_work");
+    SET(p__std_close_threadpool_work, "__std_close_threadpool_work");
+    SET(p__std_wait_for_threadpool_work_callbacks, "__std_wait_for_threadpool_work_callbacks");
     SET(p__Task_impl_base__IsNonBlockingThread, "?_IsNonBlockingThread@_Task_impl_base@details@Concurrency@@SA_NXZ");
     SET(p__ContextCallback__IsCurrentOriginSTA, "?_IsCurrentOriginSTA@_ContextCallback@details@Concurrency@@CA_NXZ");
     SET(p__Winerror_map, "?_Winerror_map@std@@YAHH@Z");
@@ -1638,10 +1650,45 @@ static void test_Copy_file(void)
     ok(SetCurrentDirectoryW(origin_path), "SetCurrentDirectoryW to origin_path failed\n");
 }
 
+static void WINAPI parallel_work_callback(PTP_CALLBACK_INSTANCE instance, void *context, PTP_WORK work)
+{
+    InterlockedIncrement((LONG *)context);
+}
+
+static void test_parallel_algorithms_exports(void)
+{
+    LONG invocations = 0;
+    unsigned int threads;
+    PTP_WORK work;
+    int i;
+
+    threads = p__std_parallel_algorithms_hw_threads();
+    ok(threads > 0, "got %u hardware threads\n", threads);
+
+    work = p__std_create_threadpool_work(parallel_work_callback, &invocations, NULL);
+    ok(work != NULL, "failed to create threadpool work\n");
+
+    p__std_bulk_submit_threadpool_work(work, 8);
+    p__std_submit_threadpool_work(work);
+    p__std_wait_for_threadpool_work_callbacks(work, FALSE);
+    p__std_close_threadpool_work(work);
+    ok(invocations == 9, "got %ld callback invocations\n", invocations);
+
+    /* cancelling pending callbacks is also supported */
+    invocations = 0;
+    work = p__std_create_threadpool_work(parallel_work_callback, &invocations, NULL);
+    ok(work != NULL, "failed to create threadpool work\n");
+    for (i = 0; i < 4; i++) p__std_submit_threadpool_work(work);
+    p__std_wait_for_threadpool_work_callbacks(work, TRUE);
+    p__std_close_threadpool_work(work);
+    ok(invocations <= 4, "got %ld callback invocations\n", invocations);
+}
+
 START_TEST(msvcp140)
 {
     if(!init()) return;
     test_thrd();
+    test_parallel_algorithms_exports();
     test__Task_impl_base__IsNonBlockingThread();
     test_vbtable_size_exports();
     test_task_continuation_context();
@@ -1325,6 +1325,48 @@ unsigned int __cdecl _Thrd_hardware_concurrency(void)
     return val;
 }
 
+#if _MSVCP_VER >= 140
+/* support exports for the C++17 parallel algorithms; they wrap the
+ * system thread pool like their native counterparts */
+unsigned int __stdcall __std_parallel_algorithms_hw_threads(void)
+{
+    TRACE("()\n");
+    return _Thrd_hardware_concurrency();
+}
+
+PTP_WORK __stdcall __std_create_threadpool_work(PTP_WORK_CALLBACK callback,
+        void *context, PTP_CALLBACK_ENVIRON env)
+{
+    TRACE("(%p %p %p)\n", callback, context, env);
+    return CreateThreadpoolWork(callback, context, env);
+}
+
+void __stdcall __std_submit_threadpool_work(PTP_WORK work)
+{
+    TRACE("(%p)\n", work);
+    SubmitThreadpoolWork(work);
+}
+
+void __stdcall __std_bulk_submit_threadpool_work(PTP_WORK work, size_t submissions)
+{
+    TRACE("(%p %Iu)\n", work, submissions);
+    while (submissions--)
+        SubmitThreadpoolWork(work);
+}
+
+void __stdcall __std_close_threadpool_work(PTP_WORK work)
+{
+    TRACE("(%p)\n", work);
+    CloseThreadpoolWork(work);
+}
+
+void __stdcall __std_wait_for_threadpool_work_callbacks(PTP_WORK work, int cancel)
+{
+    TRACE("(%p %d)\n", work, cancel);
+    WaitForThreadpoolWorkCallbacks(work, cancel);
+}
+#endif
+
 unsigned int __cdecl _Thrd_id(void)
 {
     TRACE("()\n");
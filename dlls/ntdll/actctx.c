@@ -3449,6 +3449,41 @@ static NTSTATUS find_query_actctx( HANDLE *handle, DWORD flags, ULONG class )
     return status;
 }
 
+static int __cdecl string_index_cmp(const void *a, const void *b)
+{
+    const struct string_index *left = a, *right = b;
+
+    if (left->hash != right->hash) return left->hash < right->hash ? -1 : 1;
+    /* keep duplicates in roster order so the first registration still wins */
+    if (left->rosterindex != right->rosterindex) return left->rosterindex < right->rosterindex ? -1 : 1;
+    return 0;
+}
+
+/* sort the index of a string section by hash so that lookups can use a binary search */
+static void sort_string_section(struct strsection_header *section)
+{
+    qsort((BYTE *)section + section->index_offset, section->count,
+          sizeof(struct string_index), string_index_cmp);
+}
+
+static int __cdecl guid_index_cmp(const void *a, const void *b)
+{
+    const struct guid_index *left = a, *right = b;
+    int ret = memcmp(&left->guid, &right->guid, sizeof(left->guid));
+
+    if (ret) return ret;
+    /* keep duplicates in roster order so the first registration still wins */
+    if (left->rosterindex != right->rosterindex) return left->rosterindex < right->rosterindex ? -1 : 1;
+    return 0;
+}
+
+/* sort the index of a guid section so that lookups can use a binary search */
+static void sort_guid_section(struct guidsection_header *section)
+{
+    qsort((BYTE *)section + section->index_offset, section->count,
+          sizeof(struct guid_index), guid_index_cmp);
+}
+
 static NTSTATUS build_dllredirect_section(ACTIVATION_CONTEXT* actctx, struct strsection_header **section)
 {
     unsigned int i, j, total_len = 0, dll_count = 0;
@@ -3550,6 +3585,7 @@ static NTSTATUS build_dllredirect_section(ACTIVATION_CONTEXT* actctx, struct str
         }
     }
 
+    sort_string_section( header );
     *section = header;
 
     return STATUS_SUCCESS;
@@ -3557,48 +3593,57 @@ static NTSTATUS build_dllredirect_section(ACTIVATION_CONTEXT* actctx, struct str
 
 static struct string_index *find_string_index(const struct strsection_header *section, const UNICODE_STRING *name)
 {
-    struct string_index *iter, *index = NULL;
+    struct string_index *iter, *end;
     UNICODE_STRING str;
-    ULONG hash = 0, i;
+    ULONG hash = 0;
+    int min = 0, max = section->count - 1;
 
     RtlHashUnicodeString(name, TRUE, HASH_STRING_ALGORITHM_X65599, &hash);
     iter = (struct string_index*)((BYTE*)section + section->index_offset);
+    end = iter + section->count;
 
-    for (i = 0; i < section->count; i++)
+    while (min <= max)
     {
-        if (iter->hash == hash)
+        int pos = (min + max) / 2;
+        if (iter[pos].hash < hash) min = pos + 1;
+        else if (iter[pos].hash > hash) max = pos - 1;
+        else
         {
-            str.Buffer = (WCHAR *)((BYTE *)section + iter->name_offset);
-            str.Length = iter->name_len;
-            if (RtlEqualUnicodeString( &str, name, TRUE ))
+            /* back up to the first entry with this hash, then scan the run */
+            while (pos > 0 && iter[pos - 1].hash == hash) pos--;
+            for (iter += pos; iter < end && iter->hash == hash; iter++)
             {
-                index = iter;
-                break;
-            }
-            else
+                str.Buffer = (WCHAR *)((BYTE *)section + iter->name_offset);
+                str.Length = iter->name_len;
+                if (RtlEqualUnicodeString( &str, name, TRUE )) return iter;
                 WARN("hash collision 0x%08lx, %s, %s\n", hash, debugstr_us(name), debugstr_us(&str));
+            }
+            break;
         }
-        iter++;
     }
 
-    return index;
+    return NULL;
 }
 
 static struct guid_index *find_guid_index(const struct guidsection_header *section, const GUID *guid)
 {
     struct guid_index *iter, *index = NULL;
-    ULONG i;
+    int min = 0, max = section->count - 1;
 
     iter = (struct guid_index*)((BYTE*)section + section->index_offset);
 
-    for (i = 0; i < section->count; i++)
+    while (min <= max)
     {
-        if (!memcmp(guid, &iter->guid, sizeof(*guid)))
+        int res, pos = (min + max) / 2;
+        if (!(res = memcmp(guid, &iter[pos].guid, sizeof(*guid))))
         {
-            index = iter;
+            /* back up to the first entry for this guid, in roster order */
+            while (pos > 0 && !memcmp(guid, &iter[pos - 1].guid, sizeof(*guid))) pos--;
+            index = &iter[pos];
             break;
         }
-        iter++;
+        if (res < 0) max = pos - 1;
+        else min = pos + 1;
     }
 
     return index;
@@ -3793,6 +3838,7 @@ static NTSTATUS build_wndclass_section(ACTIVATION_CONTEXT* actctx, struct strsec
         }
     }
 
+    sort_string_section( header );
     *section = header;
 
     return STATUS_SUCCESS;
@@ -3993,6 +4039,7 @@ static NTSTATUS build_activatable_class_section(ACTIVATION_CONTEXT *actctx, stru
         }
     }
 
+    sort_string_section( header );
     *section = header;
 
     return STATUS_SUCCESS;
@@ -4183,6 +4230,7 @@ static NTSTATUS build_tlib_section(ACTIVATION_CONTEXT* actctx, struct guidsectio
         }
     }
 
+    sort_guid_section( header );
     *section = header;
 
     return STATUS_SUCCESS;
@@ -4516,6 +4564,7 @@ static NTSTATUS build_comserver_section(ACTIVATION_CONTEXT* actctx, struct guids
         }
     }
 
+    sort_guid_section( header );
     *section = header;
 
     return STATUS_SUCCESS;
@@ -4706,6 +4755,7 @@ static NTSTATUS build_ifaceps_section(ACTIVATION_CONTEXT* actctx, struct guidsec
         }
     }
 
+    sort_guid_section( header );
     *section = header;
 
     return STATUS_SUCCESS;
@@ -4854,6 +4904,7 @@ static NTSTATUS build_clr_surrogate_section(ACTIVATION_CONTEXT* actctx, struct g
         }
     }
 
+    sort_guid_section( header );
     *section = header;
 
     return STATUS_SUCCESS;
@@ -5056,6 +5107,7 @@ static NTSTATUS build_progid_section(ACTIVATION_CONTEXT* actctx, struct strsecti
         }
     }
 
+    sort_string_section( header );
     *section = header;
 
     return STATUS_SUCCESS;
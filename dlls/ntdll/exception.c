@@ -606,13 +606,43 @@ PRUNTIME_FUNCTION WINAPI RtlLookupFunctionEntry( ULONG_PTR pc, ULONG_PTR *base,
     LDR_DATA_TABLE_ENTRY *module;
     RUNTIME_FUNCTION *func;
 
-    /* FIXME: should use the history table to make things faster */
+#ifdef __x86_64__
+    if (table)
+    {
+        ULONG i;
+
+        /* stack walks revisit the same few functions; check the caller's
+         * history table before searching the exception directory */
+        for (i = 0; i < table->Count; i++)
+        {
+            func = table->Entry[i].FunctionEntry;
+            if (pc >= table->Entry[i].ImageBase + func->BeginAddress &&
+                pc <  table->Entry[i].ImageBase + func->EndAddress)
+            {
+                *base = table->Entry[i].ImageBase;
+                return func;
+            }
+        }
+    }
+#endif
 
     if (!(func = lookup_function_info( pc, base, &module )))
     {
         *base = 0;
         WARN( "no exception table found for %Ix\n", pc );
     }
+#ifdef __x86_64__
+    else if (table && table->Count < UNWIND_HISTORY_TABLE_SIZE)
+    {
+        table->Entry[table->Count].ImageBase = *base;
+        table->Entry[table->Count].FunctionEntry = func;
+        if (!table->Count || *base + func->BeginAddress < table->LowAddress)
+            table->LowAddress = *base + func->BeginAddress;
+        if (!table->Count || *base + func->EndAddress > table->HighAddress)
+            table->HighAddress = *base + func->EndAddress;
+        table->Count++;
+    }
+#endif
     return func;
 }
 
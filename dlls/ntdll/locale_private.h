@@ -429,7 +429,23 @@ static inline NTSTATUS utf8_mbstowcs( WCHAR *dst, unsigned int dstlen, unsigned
 
     while ((dst < dstend) && (src < srcend))
     {
-        unsigned char ch = *src++;
+        unsigned char ch;
+
+        /* bulk-convert runs of 7-bit ASCII */
+        while (srcend - src >= 8 && dstend - dst >= 8)
+        {
+            UINT64 bytes;
+            unsigned int i;
+
+            memcpy( &bytes, src, sizeof(bytes) );
+            if (bytes & 0x8080808080808080ULL) break;
+            for (i = 0; i < 8; i++) dst[i] = (unsigned char)src[i];
+            src += 8;
+            dst += 8;
+        }
+        if (dst == dstend || src == srcend) break;
+
+        ch = *src++;
         if (ch < 0x80)  /* special fast case for 7-bit ASCII */
         {
             *dst++ = ch;
@@ -467,8 +483,24 @@ static inline NTSTATUS utf8_wcstombs( char *dst, unsigned int dstlen, unsigned i
 
     for (end = dst + dstlen; srclen; srclen--, src++)
     {
-        WCHAR ch = *src;
+        WCHAR ch;
+
+        /* bulk-convert runs of 7-bit ASCII */
+        while (srclen >= 4 && end - dst >= 4)
+        {
+            UINT64 chars;
+            unsigned int i;
+
+            memcpy( &chars, src, sizeof(chars) );
+            if (chars & 0xff80ff80ff80ff80ULL) break;
+            for (i = 0; i < 4; i++) dst[i] = (char)src[i];
+            src += 4;
+            dst += 4;
+            srclen -= 4;
+        }
+        if (!srclen) break;
 
+        ch = *src;
         if (ch < 0x80)  /* 0x00-0x7f: 1 byte */
         {
             if (dst > end - 1) break;
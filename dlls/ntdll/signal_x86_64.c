@@ -407,7 +407,7 @@ static DWORD call_teb_handler( EXCEPTION_RECORD *rec, CONTEXT *context, DISPATCH
 static NTSTATUS call_stack_handlers( EXCEPTION_RECORD *rec, CONTEXT *orig_context )
 {
     EXCEPTION_REGISTRATION_RECORD *teb_frame = NtCurrentTeb()->Tib.ExceptionList;
-    UNWIND_HISTORY_TABLE table;
+    UNWIND_HISTORY_TABLE table = { 0 };
     DISPATCHER_CONTEXT dispatch;
     CONTEXT context;
     NTSTATUS status;
@@ -1551,7 +1551,7 @@ static inline ULONG hash_pointers( void **ptrs, ULONG count )
  */
 USHORT WINAPI RtlCaptureStackBackTrace( ULONG skip, ULONG count, PVOID *buffer, ULONG *hash )
 {
-    UNWIND_HISTORY_TABLE table;
+    UNWIND_HISTORY_TABLE table = { 0 };
     DISPATCHER_CONTEXT dispatch;
     CONTEXT context;
     NTSTATUS status;
@@ -5295,6 +5295,89 @@ static void test_ioctl(void)
     CloseHandle(file);
 }
 
+static void test_set_zero_data(void)
+{
+    FILE_ZERO_DATA_INFORMATION zdinfo;
+    char buffer[4096], pattern[4096];
+    LARGE_INTEGER file_size, pos;
+    IO_STATUS_BLOCK iosb;
+    NTSTATUS status;
+    HANDLE file;
+    DWORD ret;
+    int i;
+
+    file = create_temp_file(0);
+    ok(file != INVALID_HANDLE_VALUE, "could not create temp file\n");
+
+    for (i = 0; i < sizeof(pattern); i++) pattern[i] = 'A' + (i % 26);
+    for (i = 0; i < 4; i++)
+    {
+        ret = 0;
+        ok(WriteFile(file, pattern, sizeof(pattern), &ret, NULL), "WriteFile failed %lu\n", GetLastError());
+        ok(ret == sizeof(pattern), "wrote %lu bytes\n", ret);
+    }
+
+    /* short input buffer */
+    memset(&iosb, 0x55, sizeof(iosb));
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_ZERO_DATA,
+                              &zdinfo, sizeof(zdinfo) - 1, NULL, 0);
+    ok(status == STATUS_INVALID_PARAMETER, "NtFsControlFile returned %lx\n", status);
+
+    /* reversed range */
+    zdinfo.FileOffset.QuadPart = 8192;
+    zdinfo.BeyondFinalZero.QuadPart = 4096;
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_ZERO_DATA,
+                              &zdinfo, sizeof(zdinfo), NULL, 0);
+    ok(status == STATUS_INVALID_PARAMETER, "NtFsControlFile returned %lx\n", status);
+
+    /* empty range succeeds and does nothing */
+    zdinfo.FileOffset.QuadPart = 4096;
+    zdinfo.BeyondFinalZero.QuadPart = 4096;
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_ZERO_DATA,
+                              &zdinfo, sizeof(zdinfo), NULL, 0);
+    ok(status == STATUS_SUCCESS, "NtFsControlFile returned %lx\n", status);
+
+    /* zero the second page */
+    zdinfo.FileOffset.QuadPart = 4096;
+    zdinfo.BeyondFinalZero.QuadPart = 8192;
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_ZERO_DATA,
+                              &zdinfo, sizeof(zdinfo), NULL, 0);
+    ok(status == STATUS_SUCCESS, "NtFsControlFile returned %lx\n", status);
+
+    /* zeroing past the end of file must not extend it */
+    zdinfo.FileOffset.QuadPart = 3 * 4096;
+    zdinfo.BeyondFinalZero.QuadPart = 16 * 4096;
+    status = pNtFsControlFile(file, NULL, NULL, NULL, &iosb, FSCTL_SET_ZERO_DATA,
+                              &zdinfo, sizeof(zdinfo), NULL, 0);
+    ok(status == STATUS_SUCCESS, "NtFsControlFile returned %lx\n", status);
+    ok(GetFileSizeEx(file, &file_size), "GetFileSizeEx failed %lu\n", GetLastError());
+    ok(file_size.QuadPart == 4 * 4096, "got file size %s\n", wine_dbgstr_longlong(file_size.QuadPart));
+
+    /* the first page is untouched, the zeroed ranges read back as zeros */
+    pos.QuadPart = 0;
+    ok(SetFilePointerEx(file, pos, NULL, FILE_BEGIN), "SetFilePointerEx failed %lu\n", GetLastError());
+    ret = 0;
+    ok(ReadFile(file, buffer, sizeof(buffer), &ret, NULL), "ReadFile failed %lu\n", GetLastError());
+    ok(ret == sizeof(buffer), "read %lu bytes\n", ret);
+    ok(!memcmp(buffer, pattern, sizeof(pattern)), "first page was modified\n");
+    ret = 0;
+    ok(ReadFile(file, buffer, sizeof(buffer), &ret, NULL), "ReadFile failed %lu\n", GetLastError());
+    ok(ret == sizeof(buffer), "read %lu bytes\n", ret);
+    for (i = 0; i < sizeof(buffer); i++) if (buffer[i]) break;
+    ok(i == sizeof(buffer), "second page not zeroed at %d\n", i);
+    ret = 0;
+    ok(ReadFile(file, buffer, sizeof(buffer), &ret, NULL), "ReadFile failed %lu\n", GetLastError());
+    ok(ret == sizeof(buffer), "read %lu bytes\n", ret);
+    ok(!memcmp(buffer, pattern, sizeof(pattern)), "third page was modified\n");
+    ret = 0;
+    ok(ReadFile(file, buffer, sizeof(buffer), &ret, NULL), "ReadFile failed %lu\n", GetLastError());
+    ok(ret == sizeof(buffer), "read %lu bytes\n", ret);
+    for (i = 0; i < sizeof(buffer); i++) if (buffer[i]) break;
+    ok(i == sizeof(buffer), "fourth page not zeroed at %d\n", i);
+
+    CloseHandle(file);
+}
+
 static void test_flush_buffers_file(void)
 {
     char path[MAX_PATH], buffer[MAX_PATH];
@@ -5673,6 +5756,7 @@ START_TEST(file)
     test_query_volume_information_file();
     test_query_attribute_information_file();
     test_ioctl();
+    test_set_zero_data();
     test_query_ea();
     test_flush_buffers_file();
     test_mailslot_name();
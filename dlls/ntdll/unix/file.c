@@ -28,6 +28,9 @@
 
 #include <assert.h>
 #include <sys/types.h>
+#ifdef HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
 #include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -87,6 +90,9 @@
 #ifdef HAVE_LINUX_MAJOR_H
 # include <linux/major.h>
 #endif
+#ifdef __linux__
+# include <linux/falloc.h>
+#endif
 #ifdef HAVE_SYS_PARAM_H
 #include <sys/param.h>
 #endif
@@ -4022,6 +4028,20 @@ NTSTATUS WINAPI NtCreateFile( HANDLE *handle, ACCESS_MASK access, OBJECT_ATTRIBU
 
     if (status == STATUS_SUCCESS)
     {
+#ifdef HAVE_POSIX_FADVISE
+        if (options & (FILE_SEQUENTIAL_ONLY | FILE_RANDOM_ACCESS))
+        {
+            int fd, needs_close;
+
+            /* let the kernel readahead follow the declared access pattern */
+            if (!server_get_unix_fd( *handle, 0, &fd, &needs_close, NULL, NULL ))
+            {
+                posix_fadvise( fd, 0, 0, (options & FILE_SEQUENTIAL_ONLY) ?
+                               POSIX_FADV_SEQUENTIAL : POSIX_FADV_RANDOM );
+                if (needs_close) close( fd );
+            }
+        }
+#endif
         if (created) io->Information = FILE_CREATED;
         else switch(disposition)
         {
@@ -4706,7 +4726,22 @@ NTSTATUS WINAPI NtSetInformationFile( HANDLE handle, IO_STATUS_BLOCK *io,
         {
             FILE_IO_PRIORITY_HINT_INFO *info = ptr;
             if (info->PriorityHint < MaximumIoPriorityHintType)
+            {
+#ifdef HAVE_POSIX_FADVISE
+                int fd, needs_close;
+
+                /* map the hint onto the readahead behavior of the fd;
+                 * background I/O shouldn't flood the page cache */
+                if (!server_get_unix_fd( handle, 0, &fd, &needs_close, NULL, NULL ))
+                {
+                    posix_fadvise( fd, 0, 0, info->PriorityHint == IoPriorityHintVeryLow ?
+                                   POSIX_FADV_RANDOM : POSIX_FADV_NORMAL );
+                    if (needs_close) close( fd );
+                }
+#else
                 TRACE( "ignoring FileIoPriorityHintInformation %u\n", info->PriorityHint );
+#endif
+            }
             else
                 status = STATUS_INVALID_PARAMETER;
         }
@@ -5596,11 +5631,34 @@ NTSTATUS WINAPI NtReadFileScatter( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
 
     while (length)
     {
+#ifdef HAVE_PREADV
+        /* read as many segment pages as possible in one syscall */
+        struct iovec iov[64];
+        const FILE_SEGMENT_ELEMENT *seg = segments;
+        unsigned int count = 0;
+        UINT batched = 0, chunk_pos = pos;
+
+        while (batched < length && count < ARRAY_SIZE(iov))
+        {
+            UINT size = min( length - batched, page_size - chunk_pos );
+            iov[count].iov_base = (char *)seg->Buffer + chunk_pos;
+            iov[count].iov_len = size;
+            count++;
+            batched += size;
+            chunk_pos = 0;
+            seg++;
+        }
+        if (offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION)
+            result = preadv( unix_handle, iov, count, offset->QuadPart + total );
+        else
+            result = readv( unix_handle, iov, count );
+#else
         if (offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION)
             result = pread( unix_handle, (char *)segments->Buffer + pos,
                             min( length - pos, page_size - pos ), offset->QuadPart + total );
         else
             result = read( unix_handle, (char *)segments->Buffer + pos, min( length - pos, page_size - pos ) );
+#endif
 
         if (result == -1)
         {
@@ -5611,9 +5669,10 @@ NTSTATUS WINAPI NtReadFileScatter( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
         if (!result) break;
         total += result;
         length -= result;
-        if ((pos += result) == page_size)
+        pos += result;
+        while (pos >= page_size)
         {
-            pos = 0;
+            pos -= page_size;
             segments++;
         }
     }
@@ -5904,11 +5963,33 @@ NTSTATUS WINAPI NtWriteFileGather( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
 
     while (length)
     {
+#ifdef HAVE_PREADV
+        /* write as many segment pages as possible in one syscall */
+        struct iovec iov[64];
+        const FILE_SEGMENT_ELEMENT *seg = segments;
+        unsigned int count = 0;
+        UINT batched = 0, chunk_pos = pos;
+
+        while (batched < length && count < ARRAY_SIZE(iov))
+        {
+            iov[count].iov_base = (char *)seg->Buffer + chunk_pos;
+            iov[count].iov_len = page_size - chunk_pos;
+            batched += page_size - chunk_pos;
+            count++;
+            chunk_pos = 0;
+            seg++;
+        }
+        if (offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION)
+            result = pwritev( unix_handle, iov, count, offset->QuadPart + total );
+        else
+            result = writev( unix_handle, iov, count );
+#else
         if (offset && offset->QuadPart != FILE_USE_FILE_POINTER_POSITION)
             result = pwrite( unix_handle, (char *)segments->Buffer + pos,
                              page_size - pos, offset->QuadPart + total );
         else
             result = write( unix_handle, (char *)segments->Buffer + pos, page_size - pos );
+#endif
 
         if (result == -1)
         {
@@ -5928,9 +6009,10 @@ NTSTATUS WINAPI NtWriteFileGather( HANDLE file, HANDLE event, PIO_APC_ROUTINE ap
         }
         total += result;
         length -= result;
-        if ((pos += result) == page_size)
+        pos += result;
+        while (pos >= page_size)
         {
-            pos = 0;
+            pos -= page_size;
             segments++;
         }
     }
@@ -6132,6 +6214,67 @@ NTSTATUS WINAPI NtFsControlFile( HANDLE handle, HANDLE event, PIO_APC_ROUTINE ap
         io->Information = 0;
         status = STATUS_SUCCESS;
         break;
+
+    case FSCTL_SET_ZERO_DATA:
+    {
+        const FILE_ZERO_DATA_INFORMATION *info = in_buffer;
+        int unix_fd, needs_close;
+
+        if (in_size < sizeof(*info) || !info ||
+            info->BeyondFinalZero.QuadPart < info->FileOffset.QuadPart)
+        {
+            status = STATUS_INVALID_PARAMETER;
+            break;
+        }
+        if ((status = server_get_unix_fd( handle, FILE_WRITE_DATA, &unix_fd, &needs_close, NULL, NULL )))
+            break;
+        status = STATUS_SUCCESS;
+        if (info->BeyondFinalZero.QuadPart > info->FileOffset.QuadPart)
+        {
+            off_t start = info->FileOffset.QuadPart, end = info->BeyondFinalZero.QuadPart;
+            int done = 0;
+
+#if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+            /* deallocate the range; the file size never changes */
+            done = !fallocate( unix_fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                               start, end - start );
+#endif
+            if (!done)  /* write explicit zeros up to the end of file */
+            {
+                struct stat st;
+
+                if (fstat( unix_fd, &st ) == -1) status = errno_to_status( errno );
+                else
+                {
+                    if (end > st.st_size) end = st.st_size;
+                    if (start < end)
+                    {
+                        char *zeros;
+
+                        if (!(zeros = calloc( 1, 65536 ))) status = STATUS_NO_MEMORY;
+                        else
+                        {
+                            while (start < end)
+                            {
+                                ssize_t ret = pwrite( unix_fd, zeros, min( end - start, 65536 ), start );
+                                if (ret == -1)
+                                {
+                                    if (errno == EINTR) continue;
+                                    status = errno_to_status( errno );
+                                    break;
+                                }
+                                start += ret;
+                            }
+                            free( zeros );
+                        }
+                    }
+                }
+            }
+        }
+        if (needs_close) close( unix_fd );
+        io->Information = 0;
+        break;
+    }
     default:
         return server_ioctl_file( handle, event, apc, apc_context, io, code,
                                   in_buffer, in_size, out_buffer, out_size );
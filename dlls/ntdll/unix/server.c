@@ -37,6 +37,7 @@
 #ifdef HAVE_PWD_H
 # include <pwd.h>
 #endif
+#include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -98,6 +99,7 @@ USHORT native_machine = 0;
 BOOL process_exiting = FALSE;
 
 timeout_t server_start_time = 0;  /* time of server startup */
+data_size_t reply_shm_size = 0;   /* size of the per-thread shared memory reply channel */
 
 sigset_t server_block_set;  /* signals to block during server calls */
 static int fd_socket = -1;  /* socket to exchange file descriptors with the server */
@@ -253,6 +255,70 @@ static inline unsigned int wait_reply( struct __server_request_info *req )
 }
 
 
+#ifdef __linux__
+
+/* wait on the shared reply channel futex; not process-private */
+static inline int reply_shm_futex_wait( const int *addr, int val, struct timespec *timeout )
+{
+#if (defined(__i386__) || defined(__arm__)) && _TIME_BITS==64
+    if (timeout && sizeof(*timeout) != 8)
+    {
+        struct {
+            long tv_sec;
+            long tv_nsec;
+        } timeout32 = { timeout->tv_sec, timeout->tv_nsec };
+
+        return syscall( __NR_futex, addr, 0 /* FUTEX_WAIT */, val, &timeout32, 0, 0 );
+    }
+#endif
+    return syscall( __NR_futex, addr, 0 /* FUTEX_WAIT */, val, timeout, 0, 0 );
+}
+
+
+/***********************************************************************
+ *           wait_reply_shm
+ *
+ * Wait for a reply on the shared memory channel of the current thread.
+ */
+static unsigned int wait_reply_shm( struct __server_request_info *req, int seq )
+{
+    struct shared_reply *shm = ntdll_get_thread_data()->reply_shm;
+    const union generic_reply *reply = (const union generic_reply *)(shm + 1);
+    struct timespec timeout;
+    unsigned int i;
+
+    for (;;)
+    {
+        for (i = 0; i < 1024; i++)
+        {
+            if (__atomic_load_n( &shm->sequence, __ATOMIC_ACQUIRE ) != seq) goto done;
+            YieldProcessor();
+        }
+        __atomic_store_n( &shm->waiting, 1, __ATOMIC_SEQ_CST );
+        if (__atomic_load_n( &shm->sequence, __ATOMIC_ACQUIRE ) != seq) goto done;
+        timeout.tv_sec = 1;
+        timeout.tv_nsec = 0;
+        if (reply_shm_futex_wait( &shm->sequence, seq, &timeout ) == -1 && errno == ETIMEDOUT)
+        {
+            /* check that the server is still alive */
+            struct pollfd pfd;
+            pfd.fd = ntdll_get_thread_data()->reply_fd;
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+            if (poll( &pfd, 1, 0 ) > 0 && (pfd.revents & (POLLHUP | POLLERR))) abort_thread(0);
+        }
+    }
+done:
+    __atomic_store_n( &shm->waiting, 0, __ATOMIC_RELAXED );
+    memcpy( &req->u.reply, reply, sizeof(req->u.reply) );
+    if (req->u.reply.reply_header.reply_size)
+        memcpy( req->reply_data, reply + 1, req->u.reply.reply_header.reply_size );
+    return req->u.reply.reply_header.error;
+}
+
+#endif  /* __linux__ */
+
+
 /***********************************************************************
  *           server_call_unlocked
  */
@@ -261,6 +327,17 @@ unsigned int server_call_unlocked( void *req_ptr )
     struct __server_request_info * const req = req_ptr;
     unsigned int ret;
 
+#ifdef __linux__
+    struct shared_reply *shm = ntdll_get_thread_data()->reply_shm;
+
+    if (shm && req->u.req.request_header.reply_size <=
+        reply_shm_size - sizeof(*shm) - sizeof(req->u.reply))
+    {
+        int seq = __atomic_load_n( &shm->sequence, __ATOMIC_ACQUIRE );
+        if ((ret = send_request( req ))) return ret;
+        return wait_reply_shm( req, seq );
+    }
+#endif
     if ((ret = send_request( req ))) return ret;
     return wait_reply( req );
 }
@@ -973,6 +1050,46 @@ static int receive_fd( obj_handle_t *handle )
 }
 
 
+/***********************************************************************
+ *           server_init_reply_shm
+ *
+ * Map the shared memory reply channel for the current thread.
+ */
+static void server_init_reply_shm(void)
+{
+#ifdef __linux__
+    obj_handle_t dummy;
+    data_size_t size = 0;
+    unsigned int ret;
+    sigset_t sigset;
+    void *ptr;
+    int fd;
+
+    server_enter_uninterrupted_section( &fd_cache_mutex, &sigset );
+    SERVER_START_REQ( get_shared_reply )
+    {
+        if (!(ret = wine_server_call( req ))) size = reply->size;
+    }
+    SERVER_END_REQ;
+    fd = ret ? -1 : receive_fd( &dummy );
+    server_leave_uninterrupted_section( &fd_cache_mutex, &sigset );
+
+    if (ret) return;  /* the server doesn't support the channel; nothing was activated */
+
+    /* the server now sends all small replies through the shared channel;
+     * failing to map it here would hang the next call, so it is fatal */
+    if (fd == -1)
+        server_protocol_error( "no fd received for the shared reply channel\n" );
+    ptr = mmap( NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    close( fd );
+    if (ptr == MAP_FAILED)
+        server_protocol_error( "failed to map the shared reply channel\n" );
+    ntdll_get_thread_data()->reply_shm = ptr;
+    reply_shm_size = size;
+#endif
+}
+
+
 /***********************************************************************/
 /* fd cache support */
 
@@ -1638,6 +1755,8 @@ size_t server_init_process(void)
 
     if (ret) server_protocol_error( "init_first_thread failed with status %x\n", ret );
 
+    server_init_reply_shm();
+
     if (!supported_machines_count)
         fatal_error( "'%s' is a 64-bit installation, it cannot be used with a 32-bit wineserver.\n",
                      config_dir );
@@ -1742,6 +1861,7 @@ void server_init_thread( void *entry_point, BOOL *suspend )
     }
     SERVER_END_REQ;
     close( reply_pipe );
+    server_init_reply_shm();
 }
 
 
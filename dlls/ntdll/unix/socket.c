@@ -29,6 +29,9 @@
 #include <sys/socket.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
+#ifdef __linux__
+# include <sys/sendfile.h>
+#endif
 #ifdef HAVE_IFADDRS_H
 # include <ifaddrs.h>
 #endif
@@ -148,6 +151,7 @@ struct async_transmit_ioctl
     const char *tail;
     unsigned int head_len;
     unsigned int tail_len;
+    int use_sendfile;           /* whether the file data can go through sendfile() */
     LARGE_INTEGER offset;
 };
 
@@ -1273,6 +1277,40 @@ static NTSTATUS try_transmit( int sock_fd, int file_fd, struct async_transmit_io
         if (async->file_len)
             read_size = min( read_size, async->file_len - async->file_cursor );
 
+#ifdef __linux__
+        if (async->use_sendfile && read_size)
+        {
+            ssize_t sent;
+
+            /* send the file body kernel-to-kernel instead of bouncing it
+             * through the staging buffer */
+            for (;;)
+            {
+                if (async->offset.QuadPart == FILE_USE_FILE_POINTER_POSITION)
+                    sent = sendfile( sock_fd, file_fd, NULL, read_size );
+                else
+                {
+                    off_t offset = async->offset.QuadPart;
+                    sent = sendfile( sock_fd, file_fd, &offset, read_size );
+                }
+                if (sent >= 0 || errno != EINTR) break;
+            }
+            TRACE( "sendfile returned %zd\n", sent );
+            if (sent >= 0)
+            {
+                if (async->offset.QuadPart != FILE_USE_FILE_POINTER_POSITION)
+                    async->offset.QuadPart += sent;
+                async->file_cursor += sent;
+                if (!sent || (async->file_len && async->file_cursor == async->file_len))
+                    async->file = NULL;
+                return STATUS_DEVICE_NOT_READY; /* still more data to send */
+            }
+            if (errno == EAGAIN) return STATUS_DEVICE_NOT_READY;
+            /* not a regular file or an old kernel; use the buffered path */
+            async->use_sendfile = 0;
+        }
+#endif
+
         TRACE( "reading %u bytes of file data\n", read_size );
         do
         {
@@ -1389,6 +1427,7 @@ static NTSTATUS sock_transmit( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc,
     async->head_len = params->head_len;
     async->tail = u64_to_user_ptr(params->tail_ptr);
     async->tail_len = params->tail_len;
+    async->use_sendfile = 1;
     async->offset = params->offset;
 
     SERVER_START_REQ( send_socket )
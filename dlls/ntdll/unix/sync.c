@@ -1924,20 +1924,32 @@ NTSTATUS WINAPI NtRemoveIoCompletionEx( HANDLE handle, FILE_IO_COMPLETION_INFORM
     {
         while (i < count)
         {
+            struct completion_info entries[31];
+            ULONG j, extra, want = min( count - i - 1, ARRAY_SIZE(entries) );
+
             SERVER_START_REQ( remove_completion )
             {
                 req->handle = wine_server_obj_handle( handle );
+                if (want) wine_server_set_reply( req, entries, want * sizeof(*entries) );
                 if (!(status = wine_server_call( req )))
                 {
                     info[i].CompletionKey             = reply->ckey;
                     info[i].CompletionValue           = reply->cvalue;
                     info[i].IoStatusBlock.Information = reply->information;
                     info[i].IoStatusBlock.Status      = reply->status;
+                    ++i;
+                    extra = wine_server_reply_size( reply ) / sizeof(*entries);
+                    for (j = 0; j < extra; j++, i++)
+                    {
+                        info[i].CompletionKey             = entries[j].ckey;
+                        info[i].CompletionValue           = entries[j].cvalue;
+                        info[i].IoStatusBlock.Information = entries[j].information;
+                        info[i].IoStatusBlock.Status      = entries[j].status;
+                    }
                 }
             }
             SERVER_END_REQ;
             if (status != STATUS_SUCCESS) break;
-            ++i;
         }
         if (i || status != STATUS_PENDING)
         {
@@ -1084,6 +1084,8 @@ static void pthread_exit_wrapper( int status )
     close( ntdll_get_thread_data()->wait_fd[1] );
     close( ntdll_get_thread_data()->reply_fd );
     close( ntdll_get_thread_data()->request_fd );
+    if (ntdll_get_thread_data()->reply_shm)
+        munmap( ntdll_get_thread_data()->reply_shm, reply_shm_size );
     pthread_exit( UIntToPtr(status) );
 }
 
@@ -195,6 +195,9 @@ static struct list teb_list = LIST_INIT( teb_list );
 #define VIRTUAL_DEBUG_DUMP_VIEW(view) do { if (TRACE_ON(virtual)) dump_view(view); } while (0)
 #define VIRTUAL_DEBUG_DUMP_RANGES() do { if (TRACE_ON(virtual_ranges)) dump_free_ranges(); } while (0)
 
+#ifndef MEM_EXTENDED_PARAMETER_NUMA_NODE_MANDATORY
+#define MEM_EXTENDED_PARAMETER_NUMA_NODE_MANDATORY 0x80000000
+#endif
 #ifndef MAP_NORESERVE
 #define MAP_NORESERVE 0
 #endif
@@ -2042,6 +2045,11 @@ static NTSTATUS map_view( struct file_view **view_ret, void *base, size_t size,
 done:
     status = create_view( view_ret, ptr, size, vprot );
     if (status != STATUS_SUCCESS) unmap_area( ptr, size );
+#ifdef MADV_HUGEPAGE
+    /* large anonymous views benefit from transparent huge pages; file
+     * mappings placed over the view later simply override the advice */
+    else if (size >= 0x200000) madvise( ptr, size, MADV_HUGEPAGE );
+#endif
     return status;
 }
 
@@ -2592,6 +2600,11 @@ static NTSTATUS map_image_into_view( struct file_view *view, const WCHAR *filena
     /* map the header */
 
     fstat( fd, &st );
+#ifdef HAVE_POSIX_FADVISE
+    /* start readahead of the whole image, overlapping the disk I/O with
+     * header parsing, relocations and the loading of dependent dlls */
+    posix_fadvise( fd, 0, st.st_size, POSIX_FADV_WILLNEED );
+#endif
     header_size = min( image_info->header_size, st.st_size );
     if ((status = map_pe_header( view->base, header_size, fd, &removable ))) return status;
 
@@ -3358,6 +3371,7 @@ static TEB *init_teb( void *ptr, BOOL is_wow )
     thread_data->reply_fd   = -1;
     thread_data->wait_fd[0] = -1;
     thread_data->wait_fd[1] = -1;
+    thread_data->reply_shm  = NULL;
     list_add_head( &teb_list, &thread_data->entry );
     return teb;
 }
@@ -4336,7 +4350,7 @@ NTSTATUS WINAPI NtAllocateVirtualMemory( HANDLE process, PVOID *ret, ULONG_PTR z
 
 static NTSTATUS get_extended_params( const MEM_EXTENDED_PARAMETER *parameters, ULONG count,
                                      ULONG_PTR *limit_low, ULONG_PTR *limit_high, ULONG_PTR *align,
-                                     ULONG *attributes, USHORT *machine )
+                                     ULONG *attributes, USHORT *machine, ULONG *numa_node )
 {
     ULONG i, present = 0;
 
@@ -4399,6 +4413,9 @@ static NTSTATUS get_extended_params( const MEM_EXTENDED_PARAMETER *parameters, U
             break;
 
         case MemExtendedParameterNumaNode:
+            *numa_node = parameters[i].ULong;
+            break;
+
         case MemExtendedParameterPartitionHandle:
         case MemExtendedParameterUserPhysicalHandle:
             FIXME( "Parameter type %d is not supported.\n", parameters[i].Type );
@@ -4427,6 +4444,7 @@ NTSTATUS WINAPI NtAllocateVirtualMemoryEx( HANDLE process, PVOID *ret, SIZE_T *s
     ULONG_PTR limit_high = 0;
     ULONG_PTR align = 0;
     ULONG attributes = 0;
+    ULONG numa_node = ~0u;
     USHORT machine = 0;
     unsigned int status;
 
@@ -4434,7 +4452,7 @@ NTSTATUS WINAPI NtAllocateVirtualMemoryEx( HANDLE process, PVOID *ret, SIZE_T *s
           process, *ret, *size_ptr, (int)type, (int)protect, parameters, (int)count );
 
     status = get_extended_params( parameters, count, &limit_low, &limit_high,
-                                  &align, &attributes, &machine );
+                                  &align, &attributes, &machine, &numa_node );
     if (status) return status;
 
     if (type & ~type_mask) return STATUS_INVALID_PARAMETER;
@@ -4468,8 +4486,25 @@ NTSTATUS WINAPI NtAllocateVirtualMemoryEx( HANDLE process, PVOID *ret, SIZE_T *s
         return result.virtual_alloc_ex.status;
     }
 
-    return allocate_virtual_memory( ret, size_ptr, type, protect,
-                                    limit_low, limit_high, align, attributes );
+    status = allocate_virtual_memory( ret, size_ptr, type, protect,
+                                      limit_low, limit_high, align, attributes );
+#if defined(__linux__) && defined(__NR_mbind)
+    if (!status && numa_node != ~0u)
+    {
+        /* bind the pages to the requested node; the node number is a soft
+         * preference unless the mandatory flag is set, matching mbind() */
+        unsigned long nodemask[64 / sizeof(unsigned long)] = { 0 };
+        ULONG node = numa_node & ~MEM_EXTENDED_PARAMETER_NUMA_NODE_MANDATORY;
+        int mode = (numa_node & MEM_EXTENDED_PARAMETER_NUMA_NODE_MANDATORY) ? 2 /* MPOL_BIND */
+                                                                            : 1 /* MPOL_PREFERRED */;
+        if (node < sizeof(nodemask) * 8)
+        {
+            nodemask[node / (8 * sizeof(*nodemask))] |= 1ul << (node % (8 * sizeof(*nodemask)));
+            syscall( __NR_mbind, *ret, *size_ptr, mode, nodemask, sizeof(nodemask) * 8, 0 );
+        }
+    }
+#endif
+    return status;
 }
 
 
@@ -5217,6 +5252,7 @@ NTSTATUS WINAPI NtMapViewOfSectionEx( HANDLE handle, HANDLE process, PVOID *addr
 {
     ULONG_PTR limit_low = 0, limit_high = 0, align = 0;
     ULONG attributes = 0;
+    ULONG numa_node = ~0u;
     USHORT machine = 0;
     unsigned int status;
     SIZE_T mask = granularity_mask;
@@ -5228,11 +5264,12 @@ NTSTATUS WINAPI NtMapViewOfSectionEx( HANDLE handle, HANDLE process, PVOID *addr
            handle, process, *addr_ptr, wine_dbgstr_longlong(offset.QuadPart), *size_ptr, (int)protect );
 
     status = get_extended_params( parameters, count, &limit_low, &limit_high,
-                                  &align, &attributes, &machine );
+                                  &align, &attributes, &machine, &numa_node );
     if (status) return status;
 
     if (align) return STATUS_INVALID_PARAMETER;
     if (*addr_ptr && (limit_low || limit_high)) return STATUS_INVALID_PARAMETER;
+    if (numa_node != ~0u) FIXME( "NUMA node %u not supported for mapped views.\n", (int)numa_node );
 
 #ifndef _WIN64
     if (!is_old_wow64() && (alloc_type & AT_ROUND_TO_PAGE))
@@ -1232,6 +1232,7 @@ typedef struct tagITypeInfoImpl
 
     /* functions  */
     TLBFuncDesc *funcdescs;
+    struct func_index_entry *func_index; /* sorted by member id, built lazily for Invoke */
 
     /* variables  */
     TLBVarDesc *vardescs;
@@ -1270,6 +1271,13 @@ static const ICreateTypeInfo2Vtbl CreateTypeInfo2Vtbl;
 static ITypeInfoImpl* ITypeInfoImpl_Constructor(void);
 static void ITypeInfoImpl_Destroy(ITypeInfoImpl *This);
 
+/* index entry for fast function lookup by member id */
+struct func_index_entry
+{
+    MEMBERID memid;
+    USHORT fdc;
+};
+
 typedef struct tagTLBContext
 {
 	unsigned int oStart;  /* start of TLB in file */
@@ -5608,6 +5616,7 @@ static void ITypeInfoImpl_Destroy(ITypeInfoImpl *This)
         typeinfo_release_funcdesc(&This->funcdescs[i]);
     }
     heap_free(This->funcdescs);
+    heap_free(This->func_index);
 
     for(i = 0; i < This->typeattr.cVars; ++i)
     {
@@ -7177,6 +7186,33 @@ static inline BOOL func_restricted( const FUNCDESC *desc )
 #define INVBUF_GET_ARG_TYPE_ARRAY(buffer, params) \
     ((VARTYPE *)((char *)(buffer) + (sizeof(VARIANTARG) + sizeof(VARIANTARG) + sizeof(VARIANTARG *)) * (params)))
 
+static int __cdecl func_index_cmp(const void *a, const void *b)
+{
+    const struct func_index_entry *left = a, *right = b;
+
+    if (left->memid != right->memid) return left->memid < right->memid ? -1 : 1;
+    return left->fdc < right->fdc ? -1 : (left->fdc > right->fdc);
+}
+
+/* get the function index sorted by member id, building it lazily */
+static const struct func_index_entry *ITypeInfo_get_func_index(ITypeInfoImpl *This)
+{
+    struct func_index_entry *index;
+    UINT fdc;
+
+    if (This->func_index) return This->func_index;
+    if (!(index = heap_alloc(This->typeattr.cFuncs * sizeof(*index)))) return NULL;
+    for (fdc = 0; fdc < This->typeattr.cFuncs; ++fdc)
+    {
+        index[fdc].memid = This->funcdescs[fdc].funcdesc.memid;
+        index[fdc].fdc = fdc;
+    }
+    qsort(index, This->typeattr.cFuncs, sizeof(*index), func_index_cmp);
+    if (InterlockedCompareExchangePointer((void **)&This->func_index, index, NULL))
+        heap_free(index);
+    return This->func_index;
+}
+
 static HRESULT WINAPI ITypeInfo_fnInvoke(
     ITypeInfo2 *iface,
     VOID  *pIUnk,
@@ -7193,6 +7229,7 @@ static HRESULT WINAPI ITypeInfo_fnInvoke(
     TYPEKIND type_kind;
     HRESULT hres;
     const TLBFuncDesc *pFuncInfo;
+    const struct func_index_entry *func_index;
     UINT fdc;
 
     TRACE("%p, %p, %ld, %#x, %p, %p, %p, %p.\n", iface, pIUnk, memid, wFlags, pDispParams,
@@ -7218,15 +7255,46 @@ static HRESULT WINAPI ITypeInfo_fnInvoke(
 
     /* we do this instead of using GetFuncDesc since it will return a fake
      * FUNCDESC for dispinterfaces and we want the real function description */
-    for (fdc = 0; fdc < This->typeattr.cFuncs; ++fdc){
-        pFuncInfo = &This->funcdescs[fdc];
-        if ((memid == pFuncInfo->funcdesc.memid) &&
-            (wFlags & pFuncInfo->funcdesc.invkind) &&
-            !func_restricted( &pFuncInfo->funcdesc ))
+    pFuncInfo = NULL;
+    if (This->typeattr.cFuncs && (func_index = ITypeInfo_get_func_index(This)))
+    {
+        int min = 0, max = This->typeattr.cFuncs - 1;
+
+        while (min <= max)
+        {
+            int pos = (min + max) / 2;
+            if (func_index[pos].memid < memid) min = pos + 1;
+            else if (func_index[pos].memid > memid) max = pos - 1;
+            else
+            {
+                /* back up to the first entry for this member id; entries with
+                 * the same id are sorted in declaration order */
+                while (pos > 0 && func_index[pos - 1].memid == memid) pos--;
+                for (; pos < This->typeattr.cFuncs && func_index[pos].memid == memid; pos++)
+                {
+                    TLBFuncDesc *info = &This->funcdescs[func_index[pos].fdc];
+                    if ((wFlags & info->funcdesc.invkind) && !func_restricted( &info->funcdesc ))
+                    {
+                        pFuncInfo = info;
+                        break;
+                    }
+                }
+                break;
+            }
+        }
+    }
+    else for (fdc = 0; fdc < This->typeattr.cFuncs; ++fdc){
+        TLBFuncDesc *info = &This->funcdescs[fdc];
+        if ((memid == info->funcdesc.memid) &&
+            (wFlags & info->funcdesc.invkind) &&
+            !func_restricted( &info->funcdesc ))
+        {
+            pFuncInfo = info;
             break;
+        }
     }
 
-    if (fdc < This->typeattr.cFuncs) {
+    if (pFuncInfo) {
         const FUNCDESC *func_desc = &pFuncInfo->funcdesc;
 
         if (TRACE_ON(ole))
@@ -10685,6 +10753,10 @@ static HRESULT WINAPI ICreateTypeInfo2_fnAddFuncDesc(ICreateTypeInfo2 *iface,
 
     TRACE("%p %u %p\n", This, index, funcDesc);
 
+    /* the function set changes; drop the Invoke lookup index */
+    heap_free(This->func_index);
+    This->func_index = NULL;
+
     if (!funcDesc || funcDesc->oVft & 3)
         return E_INVALIDARG;
 
@@ -11153,6 +11225,10 @@ static HRESULT WINAPI ICreateTypeInfo2_fnLayOut(ICreateTypeInfo2 *iface)
 
     TRACE("%p\n", This);
 
+    /* the function set changes; drop the Invoke lookup index */
+    heap_free(This->func_index);
+    This->func_index = NULL;
+
     This->needs_layout = FALSE;
 
     if (This->typeattr.typekind == TKIND_INTERFACE) {
@@ -11284,6 +11360,10 @@ static HRESULT WINAPI ICreateTypeInfo2_fnDeleteFuncDesc(ICreateTypeInfo2 *iface,
 
     TRACE("%p %u\n", This, index);
 
+    /* the function set changes; drop the Invoke lookup index */
+    heap_free(This->func_index);
+    This->func_index = NULL;
+
     if (index >= This->typeattr.cFuncs)
         return TYPE_E_ELEMENTNOTFOUND;
 
@@ -11332,6 +11412,10 @@ static HRESULT WINAPI ICreateTypeInfo2_fnDeleteImplType(ICreateTypeInfo2 *iface,
 
     TRACE("%p %u\n", This, index);
 
+    /* the function set changes; drop the Invoke lookup index */
+    heap_free(This->func_index);
+    This->func_index = NULL;
+
     if (index >= This->typeattr.cImplTypes)
         return TYPE_E_ELEMENTNOTFOUND;
 
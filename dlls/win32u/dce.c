@@ -407,7 +407,12 @@ void flush_window_surfaces( BOOL idle )
     else if ((int)(now - last_idle) < 50) goto done;
 
     LIST_FOR_EACH_ENTRY( surface, &window_surfaces, struct window_surface, entry )
+    {
+        /* drivers lock the surface even when there is nothing to flush;
+         * checking the damage bounds first keeps idle flushing cheap */
+        if (IsRectEmpty( surface->funcs->get_bounds( surface ))) continue;
         surface->funcs->flush( surface );
+    }
 done:
     pthread_mutex_unlock( &surfaces_lock );
 }
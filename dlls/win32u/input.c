@@ -407,6 +407,31 @@ static const KBDTABLES kbdus_tables =
 static LONG clipping_cursor; /* clipping thread counter */
 
 LONG global_key_state_counter = 0;
+
+/***********************************************************************
+ *           map_desktop_keystate
+ *
+ * Map the shared keystate mapping of the thread's desktop.
+ */
+static const struct shared_keystate *map_desktop_keystate(void)
+{
+    obj_handle_t handle = 0;
+    SIZE_T size = 0;
+    void *addr = NULL;
+
+    SERVER_START_REQ( get_desktop_keystate )
+    {
+        if (!wine_server_call( req )) handle = reply->handle;
+    }
+    SERVER_END_REQ;
+    if (!handle) return NULL;
+
+    if (NtMapViewOfSection( wine_server_ptr_handle( handle ), GetCurrentProcess(), &addr, 0, 0,
+                            NULL, &size, ViewShare, 0, PAGE_READONLY ))
+        addr = NULL;
+    NtClose( wine_server_ptr_handle( handle ));
+    return addr;
+}
 BOOL grab_pointer = TRUE;
 BOOL grab_fullscreen = FALSE;
 
@@ -821,6 +846,17 @@ SHORT WINAPI NtUserGetAsyncKeyState( INT key )
         key_state_info = calloc( 1, sizeof(*key_state_info) );
         get_user_thread_info()->key_state = key_state_info;
     }
+    else
+    {
+        if (!key_state_info->shm_checked)
+        {
+            key_state_info->shm = map_desktop_keystate();
+            key_state_info->shm_checked = TRUE;
+        }
+        /* a server call is only needed when the key is down or has been
+         * pressed since the last call, to update the 0x40 bit */
+        if (key_state_info->shm && !(key_state_info->shm->keystate[key] & 0xc0)) return 0;
+    }
 
     ret = 0;
     SERVER_START_REQ( get_key_state )
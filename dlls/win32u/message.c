@@ -1824,6 +1824,62 @@ static BOOL process_hardware_message( MSG *msg, UINT hw_id, const struct hardwar
  * available; -1 on error.
  * All pending sent messages are processed before returning.
  */
+
+static HANDLE get_server_queue_handle(void);
+
+static const struct shared_queue *queue_state_shm;
+
+/***********************************************************************
+ *           get_queue_state_shm
+ *
+ * Map the shared queue state page published by the server.
+ */
+static const struct shared_queue *get_queue_state_shm(void)
+{
+    static const WCHAR queue_state_nameW[] =
+        {'\\','K','e','r','n','e','l','O','b','j','e','c','t','s','\\',
+         '_','_','w','i','n','e','_','q','u','e','u','e','_','s','t','a','t','e'};
+    static LONG failed;
+    UNICODE_STRING name = { sizeof(queue_state_nameW), sizeof(queue_state_nameW), (WCHAR *)queue_state_nameW };
+    OBJECT_ATTRIBUTES attr;
+    HANDLE handle;
+    SIZE_T size = 0;
+    void *addr = NULL;
+
+    if (queue_state_shm) return queue_state_shm;
+    if (failed) return NULL;
+
+    InitializeObjectAttributes( &attr, &name, 0, 0, NULL );
+    if (NtOpenSection( &handle, SECTION_MAP_READ, &attr ))
+    {
+        failed = 1;
+        return NULL;
+    }
+    if (!NtMapViewOfSection( handle, GetCurrentProcess(), &addr, 0, 0, NULL, &size,
+                             ViewShare, 0, PAGE_READONLY ))
+    {
+        if (InterlockedCompareExchangePointer( (void **)&queue_state_shm, addr, NULL ))
+            NtUnmapViewOfSection( GetCurrentProcess(), addr );
+    }
+    else failed = 1;
+    NtClose( handle );
+    return queue_state_shm;
+}
+
+/* return the shared state slot of the thread message queue, if still valid */
+static const volatile struct shared_queue *get_queue_shm_slot( struct user_thread_info *thread_info )
+{
+    const struct shared_queue *shm;
+
+    if (!thread_info->queue_shm_id || !(shm = get_queue_state_shm())) return NULL;
+    if (shm[thread_info->queue_shm_slot].id != thread_info->queue_shm_id)
+    {
+        thread_info->queue_shm_id = 0;
+        return NULL;
+    }
+    return &shm[thread_info->queue_shm_slot];
+}
+
 static int peek_message( MSG *msg, HWND hwnd, UINT first, UINT last, UINT flags, UINT changed_mask )
 {
     LRESULT result;
@@ -1831,9 +1887,24 @@ static int peek_message( MSG *msg, HWND hwnd, UINT first, UINT last, UINT flags,
     INPUT_MESSAGE_SOURCE prev_source = thread_info->client_info.msg_source;
     struct received_message_info info;
     unsigned int hw_id = 0;  /* id of previous hardware message */
+    const volatile struct shared_queue *shm_queue;
     void *buffer;
     size_t buffer_size = 1024;
 
+    /* when the shared queue state shows nothing pending at all, the server
+     * peek cannot return a message; skip the round trip.  A server peek is
+     * still forced periodically to keep the queue from looking hung. */
+    if (!thread_info->server_queue) get_server_queue_handle();
+    if ((shm_queue = get_queue_shm_slot( thread_info )) && !shm_queue->wake_bits
+        && NtGetTickCount() - thread_info->last_server_peek < 1000)
+    {
+        /* note that thread_info->wake_mask/changed_mask are deliberately not
+         * updated here: they mirror the masks the server queue was last set
+         * to, and a later wait still needs to send them */
+        thread_info->client_info.msg_source = prev_source;
+        return 0;
+    }
+
     if (!(buffer = malloc( buffer_size ))) return -1;
 
     if (!first && !last) last = ~0;
@@ -1875,6 +1946,7 @@ static int peek_message( MSG *msg, HWND hwnd, UINT first, UINT last, UINT flags,
             else buffer_size = reply->total;
         }
         SERVER_END_REQ;
+        thread_info->last_server_peek = NtGetTickCount();
 
         if (res)
         {
@@ -2110,7 +2182,11 @@ static HANDLE get_server_queue_handle(void)
     {
         SERVER_START_REQ( get_msg_queue )
         {
-            wine_server_call( req );
+            if (!wine_server_call( req ) && reply->slot >= 0 && reply->slot < SHARED_QUEUE_SLOTS)
+            {
+                thread_info->queue_shm_slot = reply->slot;
+                thread_info->queue_shm_id   = reply->shm_id;
+            }
             ret = wine_server_ptr_handle( reply->handle );
         }
         SERVER_END_REQ;
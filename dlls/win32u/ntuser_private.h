@@ -125,6 +125,9 @@ struct user_thread_info
     UINT                          active_hooks;           /* Bitmap of active hooks */
     struct received_message_info *receive_info;           /* Message being currently received */
     struct user_key_state_info   *key_state;              /* Cache of global key state */
+    INT                           queue_shm_slot;         /* Slot in the shared queue state page */
+    UINT                          queue_shm_id;           /* Id validating the queue state slot */
+    UINT                          last_server_peek;       /* Tick count of the last server message peek */
     struct imm_thread_data       *imm_thread_data;        /* IMM thread data */
     HKL                           kbd_layout;             /* Current keyboard layout */
     UINT                          kbd_layout_id;          /* Current keyboard layout ID */
@@ -145,6 +148,8 @@ struct user_key_state_info
 {
     UINT  time;          /* Time of last key state refresh */
     INT   counter;       /* Counter to invalidate the key state */
+    const struct shared_keystate *shm; /* Mapped keystate of the thread desktop */
+    BOOL  shm_checked;   /* Whether mapping the desktop keystate was attempted */
     BYTE  state[256];    /* State for each key */
 };
 
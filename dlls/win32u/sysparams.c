@@ -6150,6 +6150,8 @@ static void thread_detach(void)
 
     user_driver->pThreadDetach();
 
+    if (thread_info->key_state && thread_info->key_state->shm)
+        NtUnmapViewOfSection( GetCurrentProcess(), (void *)thread_info->key_state->shm );
     free( thread_info->key_state );
     thread_info->key_state = 0;
     free( thread_info->rawinput );
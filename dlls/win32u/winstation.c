@@ -263,7 +263,14 @@ BOOL WINAPI NtUserSetThreadDesktop( HDESK handle )
         struct user_key_state_info *key_state_info = thread_info->key_state;
         thread_info->client_info.top_window = 0;
         thread_info->client_info.msg_window = 0;
-        if (key_state_info) key_state_info->time = 0;
+        if (key_state_info)
+        {
+            key_state_info->time = 0;
+            if (key_state_info->shm)
+                NtUnmapViewOfSection( GetCurrentProcess(), (void *)key_state_info->shm );
+            key_state_info->shm = NULL;
+            key_state_info->shm_checked = FALSE;
+        }
         if (was_virtual_desktop != is_virtual_desktop()) update_display_cache( TRUE );
     }
     return ret;
@@ -169,6 +169,9 @@ static const struct wined3d_extension_map gl_extension_map[] =
     {"GL_ATI_texture_env_combine3",         ATI_TEXTURE_ENV_COMBINE3      },
     {"GL_ATI_texture_mirror_once",          ATI_TEXTURE_MIRROR_ONCE       },
 
+    /* KHR */
+    {"GL_KHR_parallel_shader_compile",      KHR_PARALLEL_SHADER_COMPILE   },
+
     /* EXT */
     {"GL_EXT_blend_color",                  EXT_BLEND_COLOR               },
     {"GL_EXT_blend_equation_separate",      EXT_BLEND_EQUATION_SEPARATE   },
@@ -2447,6 +2450,8 @@ static void load_gl_funcs(struct wined3d_gl_info *gl_info)
     /* GL_ATI_separate_stencil */
     USE_GL_FUNC(glStencilOpSeparateATI)
     USE_GL_FUNC(glStencilFuncSeparateATI)
+    /* GL_KHR_parallel_shader_compile */
+    USE_GL_FUNC(glMaxShaderCompilerThreadsKHR)
     /* GL_EXT_blend_color */
     USE_GL_FUNC(glBlendColorEXT)
     /* GL_EXT_blend_equation_separate */
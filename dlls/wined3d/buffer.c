@@ -508,7 +508,12 @@ ULONG CDECL wined3d_buffer_incref(struct wined3d_buffer *buffer)
 
 static void buffer_conversion_upload(struct wined3d_buffer *buffer, struct wined3d_context *context)
 {
-    unsigned int i, j, range_idx, start, end, vertex_count;
+    unsigned int i, j, c, range_idx, start, end, vertex_count, conv_count = 0;
+    struct buffer_conversion_entry
+    {
+        unsigned int offset;
+        enum wined3d_buffer_conversion_type type;
+    } *convs;
     struct wined3d_bo_address src, dst;
     BYTE *data;
 
@@ -528,6 +533,38 @@ static void buffer_conversion_upload(struct wined3d_buffer *buffer, struct wined
         return;
     }
 
+    /* Collect the offsets that actually need conversion; everything else is
+     * covered by the bulk copy below, so the per-vertex loop only needs to
+     * touch the converted attributes. */
+    if (!(convs = heap_alloc((buffer->stride / sizeof(DWORD) + 1) * sizeof(*convs))))
+    {
+        ERR("Out of memory.\n");
+        heap_free(data);
+        return;
+    }
+    for (j = 0; j < buffer->stride;)
+    {
+        switch (buffer->conversion_map[j])
+        {
+            case CONV_NONE:
+                j += sizeof(DWORD);
+                break;
+            case CONV_D3DCOLOR:
+                convs[conv_count].offset = j;
+                convs[conv_count++].type = CONV_D3DCOLOR;
+                j += sizeof(DWORD);
+                break;
+            case CONV_POSITIONT:
+                convs[conv_count].offset = j;
+                convs[conv_count++].type = CONV_POSITIONT;
+                j += sizeof(struct wined3d_vec4);
+                break;
+            default:
+                FIXME("Unimplemented conversion %d in shifted conversion.\n", buffer->conversion_map[j]);
+                ++j;
+        }
+    }
+
     for (range_idx = 0; range_idx < buffer->modified_areas; ++range_idx)
     {
         start = buffer->maps[range_idx].offset;
@@ -536,27 +573,16 @@ static void buffer_conversion_upload(struct wined3d_buffer *buffer, struct wined
         memcpy(data + start, (BYTE *)buffer->resource.heap_memory + start, end - start);
         for (i = start / buffer->stride; i < min((end / buffer->stride) + 1, vertex_count); ++i)
         {
-            for (j = 0; j < buffer->stride;)
+            for (c = 0; c < conv_count; ++c)
             {
-                switch (buffer->conversion_map[j])
-                {
-                    case CONV_NONE:
-                        /* Done already */
-                        j += sizeof(DWORD);
-                        break;
-                    case CONV_D3DCOLOR:
-                        j += fixup_d3dcolor((DWORD *) (data + i * buffer->stride + j));
-                        break;
-                    case CONV_POSITIONT:
-                        j += fixup_transformed_pos((struct wined3d_vec4 *) (data + i * buffer->stride + j));
-                        break;
-                    default:
-                        FIXME("Unimplemented conversion %d in shifted conversion.\n", buffer->conversion_map[j]);
-                        ++j;
-                }
+                if (convs[c].type == CONV_D3DCOLOR)
+                    fixup_d3dcolor((DWORD *)(data + i * buffer->stride + convs[c].offset));
+                else
+                    fixup_transformed_pos((struct wined3d_vec4 *)(data + i * buffer->stride + convs[c].offset));
             }
         }
     }
+    heap_free(convs);
 
     dst.buffer_object = buffer->buffer_object;
     dst.addr = NULL;
@@ -2318,6 +2318,12 @@ HRESULT wined3d_context_gl_init(struct wined3d_context_gl *context_gl, struct wi
     }
     if (gl_info->supported[ARB_CLIP_CONTROL])
         GL_EXTCALL(glPointParameteri(GL_POINT_SPRITE_COORD_ORIGIN, GL_LOWER_LEFT));
+    if (gl_info->supported[KHR_PARALLEL_SHADER_COMPILE])
+    {
+        /* let the driver compile shaders on as many threads as it likes */
+        GL_EXTCALL(glMaxShaderCompilerThreadsKHR(~0u));
+        checkGLcall("enable parallel shader compilation");
+    }
 
     /* If this happens to be the first context for the device, dummy textures
      * are not created yet. In that case, they will be created (and bound) by
@@ -711,15 +711,32 @@ static void wined3d_cs_exec_present(struct wined3d_cs *cs, const void *data)
     if (TRACE_ON(fps))
     {
         DWORD time = GetTickCount();
+        LARGE_INTEGER qpc, qpc_freq;
+
+        QueryPerformanceCounter(&qpc);
+        if (swapchain->frame_qpc_prev)
+        {
+            UINT64 frame_time = qpc.QuadPart - swapchain->frame_qpc_prev;
+
+            if (!swapchain->frames || frame_time < swapchain->frame_time_min)
+                swapchain->frame_time_min = frame_time;
+            if (frame_time > swapchain->frame_time_max)
+                swapchain->frame_time_max = frame_time;
+        }
+        swapchain->frame_qpc_prev = qpc.QuadPart;
         ++swapchain->frames;
 
         /* every 1.5 seconds */
         if (time - swapchain->prev_time > 1500)
         {
-            TRACE_(fps)("%p @ approx %.2ffps\n",
-                    swapchain, 1000.0 * swapchain->frames / (time - swapchain->prev_time));
+            QueryPerformanceFrequency(&qpc_freq);
+            TRACE_(fps)("%p @ approx %.2ffps, frame time %.2f-%.2fms\n",
+                    swapchain, 1000.0 * swapchain->frames / (time - swapchain->prev_time),
+                    swapchain->frame_time_min * 1000.0 / qpc_freq.QuadPart,
+                    swapchain->frame_time_max * 1000.0 / qpc_freq.QuadPart);
             swapchain->prev_time = time;
             swapchain->frames = 0;
+            swapchain->frame_time_max = 0;
         }
     }
 
@@ -3189,6 +3206,7 @@ static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size
     size_t queue_size = ARRAY_SIZE(queue->data);
     size_t header_size, packet_size, remaining;
     struct wined3d_cs_packet *packet;
+    unsigned int spin_count = 0;
     ULONG head = queue->head & WINED3D_CS_QUEUE_MASK;
 
     header_size = FIELD_OFFSET(struct wined3d_cs_packet, data[0]);
@@ -3238,6 +3256,12 @@ static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size
 
         TRACE("Waiting for free space. Head %lu, tail %lu, packet size %Iu.\n",
                 head, tail, packet_size);
+
+        /* The CS thread may need a while to drain the queue; don't burn a
+         * full core spinning on it. */
+        YieldProcessor();
+        if (++spin_count >= WINED3D_CS_SPIN_COUNT)
+            Sleep(0);
     }
 
     packet = (struct wined3d_cs_packet *)&queue->data[head];
@@ -3259,12 +3283,17 @@ static void *wined3d_cs_mt_require_space(struct wined3d_device_context *context,
 static void wined3d_cs_mt_finish(struct wined3d_device_context *context, enum wined3d_cs_queue_id queue_id)
 {
     struct wined3d_cs *cs = wined3d_cs_from_context(context);
+    unsigned int spin_count = 0;
 
     if (cs->thread_id == GetCurrentThreadId())
         return wined3d_cs_st_finish(context, queue_id);
 
     while (cs->queue[queue_id].head != *(volatile ULONG *)&cs->queue[queue_id].tail)
+    {
         YieldProcessor();
+        if (++spin_count >= WINED3D_CS_SPIN_COUNT)
+            Sleep(0);
+    }
 }
 
 static const struct wined3d_device_context_ops wined3d_cs_mt_ops =
@@ -4038,6 +4067,9 @@ struct wined3d_deferred_context
 
     SIZE_T resource_count, resources_capacity;
     struct wined3d_resource **resources;
+    /* direct-mapped cache of recently referenced resources, to skip
+     * duplicate references for the working set of the command stream */
+    struct wined3d_resource *resource_cache[64];
 
     SIZE_T upload_count, uploads_capacity;
     struct wined3d_deferred_upload *uploads;
@@ -4248,12 +4280,18 @@ static void wined3d_deferred_context_reference_resource(struct wined3d_device_co
         struct wined3d_resource *resource)
 {
     struct wined3d_deferred_context *deferred = wined3d_deferred_context_from_context(context);
+    size_t idx = ((ULONG_PTR)resource >> 4) % ARRAY_SIZE(deferred->resource_cache);
+
+    /* a cached hit already holds a reference in the resources array */
+    if (deferred->resource_cache[idx] == resource)
+        return;
 
     if (!wined3d_array_reserve((void **)&deferred->resources, &deferred->resources_capacity,
             deferred->resource_count + 1, sizeof(*deferred->resources)))
         return;
 
     deferred->resources[deferred->resource_count++] = resource;
+    deferred->resource_cache[idx] = resource;
     wined3d_resource_incref(resource);
 }
 
@@ -4421,6 +4459,7 @@ HRESULT CDECL wined3d_deferred_context_record_command_list(struct wined3d_device
 
     deferred->data_size = 0;
     deferred->resource_count = 0;
+    memset(deferred->resource_cache, 0, sizeof(deferred->resource_cache));
     deferred->upload_count = 0;
     deferred->command_list_count = 0;
     deferred->query_count = 0;
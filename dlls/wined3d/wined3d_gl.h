@@ -153,6 +153,8 @@ enum wined3d_gl_extension
     ATI_TEXTURE_COMPRESSION_3DC,
     ATI_TEXTURE_ENV_COMBINE3,
     ATI_TEXTURE_MIRROR_ONCE,
+    /* KHR */
+    KHR_PARALLEL_SHADER_COMPILE,
     /* EXT */
     EXT_BLEND_COLOR,
     EXT_BLEND_EQUATION_SEPARATE,
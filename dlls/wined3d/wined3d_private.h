@@ -4960,6 +4960,8 @@ struct wined3d_swapchain
     unsigned int max_frame_latency;
 
     LONG prev_time, frames;   /* Performance tracking */
+    UINT64 frame_qpc_prev;    /* Frame pacing tracking */
+    UINT64 frame_time_min, frame_time_max;
 
     struct wined3d_swapchain_state state;
     HWND win_handle;
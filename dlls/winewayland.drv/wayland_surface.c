@@ -237,6 +237,21 @@ void wayland_surface_attach_shm(struct wayland_surface *surface,
     shm_buffer->busy = TRUE;
     wayland_shm_buffer_ref(shm_buffer);
 
+    /* All the buffers we attach are XRGB, so the surface is fully opaque;
+     * letting the compositor know enables composition bypass/direct scanout. */
+    if (shm_buffer->width != surface->opaque_width || shm_buffer->height != surface->opaque_height)
+    {
+        struct wl_region *opaque_region = wl_compositor_create_region(process_wayland.wl_compositor);
+        if (opaque_region)
+        {
+            wl_region_add(opaque_region, 0, 0, shm_buffer->width, shm_buffer->height);
+            wl_surface_set_opaque_region(surface->wl_surface, opaque_region);
+            wl_region_destroy(opaque_region);
+            surface->opaque_width = shm_buffer->width;
+            surface->opaque_height = shm_buffer->height;
+        }
+    }
+
     wl_surface_attach(surface->wl_surface, shm_buffer->wl_buffer, 0, 0);
 
     /* Add surface damage, i.e., which parts of the surface have changed since
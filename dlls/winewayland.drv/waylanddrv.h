@@ -108,6 +108,7 @@ struct wayland_surface
     pthread_mutex_t mutex;
     uint32_t current_serial;
     struct wayland_shm_buffer *latest_window_buffer;
+    int opaque_width, opaque_height;
 };
 
 struct wayland_shm_buffer
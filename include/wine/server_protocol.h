@@ -184,6 +184,31 @@ struct wake_up_reply
 };
 
 
+struct shared_reply
+{
+    int          sequence;
+    int          waiting;
+
+};
+#define SHARED_REPLY_SIZE 4096
+
+
+struct shared_keystate
+{
+    unsigned char keystate[256];
+};
+
+
+struct shared_queue
+{
+    unsigned int  id;
+    unsigned int  wake_bits;
+    unsigned int  changed_bits;
+    unsigned int  __pad;
+};
+#define SHARED_QUEUE_SLOTS 256
+
+
 typedef __int64 timeout_t;
 #define TIMEOUT_INFINITE (((timeout_t)0x7fffffff) << 32 | 0xffffffff)
 
@@ -1018,6 +1043,20 @@ struct init_thread_reply
 
 
 
+struct get_shared_reply_request
+{
+    struct request_header __header;
+    char __pad_12[4];
+};
+struct get_shared_reply_reply
+{
+    struct reply_header __header;
+    data_size_t  size;
+    char __pad_12[4];
+};
+
+
+
 struct terminate_process_request
 {
     struct request_header __header;
@@ -2718,7 +2757,9 @@ struct get_msg_queue_reply
 {
     struct reply_header __header;
     obj_handle_t handle;
-    char __pad_12[4];
+    int          slot;
+    unsigned int shm_id;
+    char __pad_20[4];
 };
 
 
@@ -3841,6 +3882,20 @@ struct get_thread_desktop_reply
 
 
 
+struct get_desktop_keystate_request
+{
+    struct request_header __header;
+    char __pad_12[4];
+};
+struct get_desktop_keystate_reply
+{
+    struct reply_header __header;
+    obj_handle_t handle;
+    char __pad_12[4];
+};
+
+
+
 struct set_thread_desktop_request
 {
     struct request_header __header;
@@ -5165,6 +5220,16 @@ struct add_completion_reply
 
 
 
+
+struct completion_info
+{
+    apc_param_t   ckey;
+    apc_param_t   cvalue;
+    apc_param_t   information;
+    unsigned int  status;
+    unsigned int  __pad;
+};
+
 struct remove_completion_request
 {
     struct request_header __header;
@@ -5177,6 +5242,7 @@ struct remove_completion_reply
     apc_param_t   cvalue;
     apc_param_t   information;
     unsigned int  status;
+    /* VARARG(data,completion_infos); */
     char __pad_36[4];
 };
 
@@ -5584,6 +5650,7 @@ enum request
     REQ_init_process_done,
     REQ_init_first_thread,
     REQ_init_thread,
+    REQ_get_shared_reply,
     REQ_terminate_process,
     REQ_terminate_thread,
     REQ_get_process_info,
@@ -5752,6 +5819,7 @@ enum request
     REQ_open_input_desktop,
     REQ_close_desktop,
     REQ_get_thread_desktop,
+    REQ_get_desktop_keystate,
     REQ_set_thread_desktop,
     REQ_enum_desktop,
     REQ_set_user_object_info,
@@ -5872,6 +5940,7 @@ union generic_request
     struct init_process_done_request init_process_done_request;
     struct init_first_thread_request init_first_thread_request;
     struct init_thread_request init_thread_request;
+    struct get_shared_reply_request get_shared_reply_request;
     struct terminate_process_request terminate_process_request;
     struct terminate_thread_request terminate_thread_request;
     struct get_process_info_request get_process_info_request;
@@ -6040,6 +6109,7 @@ union generic_request
     struct open_input_desktop_request open_input_desktop_request;
     struct close_desktop_request close_desktop_request;
     struct get_thread_desktop_request get_thread_desktop_request;
+    struct get_desktop_keystate_request get_desktop_keystate_request;
     struct set_thread_desktop_request set_thread_desktop_request;
     struct enum_desktop_request enum_desktop_request;
     struct set_user_object_info_request set_user_object_info_request;
@@ -6158,6 +6228,7 @@ union generic_reply
     struct init_process_done_reply init_process_done_reply;
     struct init_first_thread_reply init_first_thread_reply;
     struct init_thread_reply init_thread_reply;
+    struct get_shared_reply_reply get_shared_reply_reply;
     struct terminate_process_reply terminate_process_reply;
     struct terminate_thread_reply terminate_thread_reply;
     struct get_process_info_reply get_process_info_reply;
@@ -6326,6 +6397,7 @@ union generic_reply
     struct open_input_desktop_reply open_input_desktop_reply;
     struct close_desktop_reply close_desktop_reply;
     struct get_thread_desktop_reply get_thread_desktop_reply;
+    struct get_desktop_keystate_reply get_desktop_keystate_reply;
     struct set_thread_desktop_reply set_thread_desktop_reply;
     struct enum_desktop_reply enum_desktop_reply;
     struct set_user_object_info_reply set_user_object_info_reply;
@@ -6436,7 +6508,7 @@ union generic_reply
 
 /* ### protocol_version begin ### */
 
-#define SERVER_PROTOCOL_VERSION 779
+#define SERVER_PROTOCOL_VERSION 784
 
 /* ### protocol_version end ### */
 
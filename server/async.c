@@ -714,7 +714,15 @@ struct async *create_request_async( struct fd *fd, unsigned int comp_flags, cons
     struct async *async;
     struct iosb *iosb;
 
-    if (!(iosb = create_iosb( get_req_data(), get_req_data_size(), get_reply_max_size() )))
+    if (current->req.request_header.req == REQ_write)
+    {
+        /* the write payload is consumed through the iosb only; steal the
+         * request data instead of copying it */
+        if (!(iosb = create_iosb( NULL, 0, get_reply_max_size() ))) return NULL;
+        iosb->in_size = get_req_data_size();
+        iosb->in_data = detach_req_data();
+    }
+    else if (!(iosb = create_iosb( get_req_data(), get_req_data_size(), get_reply_max_size() )))
         return NULL;
 
     async = create_async( fd, current, data, iosb );
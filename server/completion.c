@@ -223,6 +223,9 @@ DECL_HANDLER(remove_completion)
         set_error( STATUS_PENDING );
     else
     {
+        struct completion_info *info;
+        unsigned int i, count;
+
         list_remove( entry );
         completion->depth--;
         msg = LIST_ENTRY( entry, struct comp_msg, queue_entry );
@@ -231,6 +234,25 @@ DECL_HANDLER(remove_completion)
         reply->status = msg->status;
         reply->information = msg->information;
         free( msg );
+
+        /* hand out additional queued completions while they fit in the reply */
+        count = min( get_reply_max_size() / sizeof(*info), completion->depth );
+        if (count && (info = set_reply_data_size( count * sizeof(*info) )))
+        {
+            for (i = 0; i < count; i++)
+            {
+                entry = list_head( &completion->queue );
+                list_remove( entry );
+                completion->depth--;
+                msg = LIST_ENTRY( entry, struct comp_msg, queue_entry );
+                info[i].ckey        = msg->ckey;
+                info[i].cvalue      = msg->cvalue;
+                info[i].status      = msg->status;
+                info[i].information = msg->information;
+                info[i].__pad       = 0;
+                free( msg );
+            }
+        }
     }
 
     release_object( completion );
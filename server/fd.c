@@ -84,10 +84,14 @@
 #include <sys/sysmacros.h>
 #endif
 #include <sys/types.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #ifdef HAVE_SYS_SYSCALL_H
 #include <sys/syscall.h>
 #endif
+#ifdef HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#endif
 
 #include "ntstatus.h"
 #define WIN32_NO_STATUS
@@ -460,25 +464,27 @@ struct timeout_user *add_timeout_user( timeout_t when, timeout_callback func, vo
     user->callback = func;
     user->private  = private;
 
-    /* Now insert it in the linked list */
+    /* Now insert it in the linked list; most timeouts expire later than all
+     * the queued ones, so scanning backwards makes insertion O(1) for them */
 
     if (user->when > 0)
     {
-        LIST_FOR_EACH( ptr, &abs_timeout_list )
+        LIST_FOR_EACH_REV( ptr, &abs_timeout_list )
         {
             struct timeout_user *timeout = LIST_ENTRY( ptr, struct timeout_user, entry );
-            if (timeout->when >= user->when) break;
+            if (timeout->when < user->when) break;
         }
+        list_add_after( ptr, &user->entry );
     }
     else
     {
-        LIST_FOR_EACH( ptr, &rel_timeout_list )
+        LIST_FOR_EACH_REV( ptr, &rel_timeout_list )
         {
             struct timeout_user *timeout = LIST_ENTRY( ptr, struct timeout_user, entry );
-            if (timeout->when <= user->when) break;
+            if (timeout->when > user->when) break;
         }
+        list_add_after( ptr, &user->entry );
     }
-    list_add_before( ptr, &user->entry );
     return user;
 }
 
@@ -546,8 +552,279 @@ static inline void fd_poll_event( struct fd *fd, int event )
 
 static int epoll_fd = -1;
 
+#if defined(HAVE_LINUX_IO_URING_H) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define USE_IO_URING
+
+/* fall back gracefully when building against older uapi headers */
+#ifndef IORING_FEAT_SINGLE_MMAP
+#define IORING_FEAT_SINGLE_MMAP (1U << 0)
+#endif
+#ifndef IORING_FEAT_NODROP
+#define IORING_FEAT_NODROP (1U << 1)
+#endif
+#ifndef IORING_FEAT_EXT_ARG
+#define IORING_FEAT_EXT_ARG (1U << 8)
+#endif
+#ifndef IORING_ENTER_EXT_ARG
+#define IORING_ENTER_EXT_ARG (1U << 3)
+#endif
+
+static int uring_fd = -1;
+static struct io_uring_params uring_params;
+static void *uring_ring_ptr;
+static size_t uring_ring_size;
+static struct io_uring_sqe *uring_sqes;
+static unsigned int *uring_sq_head, *uring_sq_tail, *uring_sq_mask, *uring_sq_array;
+static unsigned int *uring_cq_head, *uring_cq_tail, *uring_cq_mask;
+static struct io_uring_cqe *uring_cqes;
+
+/* per poll user state of the submitted poll request */
+struct uring_user
+{
+    unsigned int gen;     /* generation count to detect stale completions */
+    int          events;  /* events of the poll request in flight, or -1 */
+};
+static struct uring_user *uring_users;
+static unsigned int uring_nb_users;
+
+/* same layout as struct io_uring_getevents_arg; avoids depending on 5.11 headers */
+struct uring_getevents_arg
+{
+    uint64_t sigmask;
+    uint32_t sigmask_sz;
+    uint32_t pad;
+    uint64_t ts;
+};
+
+/* give up on io_uring; the plain poll loop takes over from the pollfd array */
+static void uring_failed(void)
+{
+    if (uring_fd == -1) return;
+    close( uring_fd );
+    uring_fd = -1;
+}
+
+/* submit the queued sqes, optionally waiting for a completion */
+static int uring_enter( unsigned int wait, int timeout )
+{
+    struct uring_getevents_arg arg;
+    struct timespec ts;
+    unsigned int to_submit = *uring_sq_tail - __atomic_load_n( uring_sq_head, __ATOMIC_ACQUIRE );
+    unsigned int flags = 0;
+
+    memset( &arg, 0, sizeof(arg) );
+    if (wait)
+    {
+        flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+        if (timeout != -1)
+        {
+            ts.tv_sec = timeout / 1000;
+            ts.tv_nsec = (timeout % 1000) * 1000000;
+            arg.ts = (uintptr_t)&ts;
+        }
+    }
+    return syscall( __NR_io_uring_enter, uring_fd, to_submit, wait, flags, &arg, sizeof(arg) );
+}
+
+/* grab the next free sqe, flushing the submission queue if it is full */
+static struct io_uring_sqe *get_uring_sqe(void)
+{
+    unsigned int head = __atomic_load_n( uring_sq_head, __ATOMIC_ACQUIRE );
+    unsigned int tail = *uring_sq_tail;
+    struct io_uring_sqe *sqe;
+
+    if (tail - head == uring_params.sq_entries)
+    {
+        while (uring_enter( 0, -1 ) == -1)
+        {
+            if (errno == EINTR) continue;
+            uring_failed();
+            return NULL;
+        }
+        head = __atomic_load_n( uring_sq_head, __ATOMIC_ACQUIRE );
+        if (tail - head == uring_params.sq_entries) return NULL;
+    }
+    sqe = &uring_sqes[tail & *uring_sq_mask];
+    memset( sqe, 0, sizeof(*sqe) );
+    uring_sq_array[tail & *uring_sq_mask] = tail & *uring_sq_mask;
+    __atomic_store_n( uring_sq_tail, tail + 1, __ATOMIC_RELEASE );
+    return sqe;
+}
+
+/* queue a one-shot poll request for a poll user */
+static void arm_uring_poll( int user, int unix_fd, int events )
+{
+    struct io_uring_sqe *sqe;
+
+    if (uring_fd == -1) return;
+    if (!(sqe = get_uring_sqe()))
+    {
+        uring_failed();  /* rather fall back to poll than lose the request */
+        return;
+    }
+    sqe->opcode      = IORING_OP_POLL_ADD;
+    sqe->fd          = unix_fd;
+    sqe->poll_events = events;
+    sqe->user_data   = (uint64_t)uring_users[user].gen << 32 | user;
+    uring_users[user].events = events;
+}
+
+/* cancel the poll request in flight for a poll user */
+static void cancel_uring_poll( int user )
+{
+    struct io_uring_sqe *sqe;
+
+    if (user >= uring_nb_users || uring_users[user].events == -1) return;
+    uring_users[user].events = -1;
+    if (uring_fd == -1 || !(sqe = get_uring_sqe())) return;
+    sqe->opcode    = IORING_OP_POLL_REMOVE;
+    sqe->addr      = (uint64_t)uring_users[user].gen << 32 | user;
+    sqe->user_data = ~(uint64_t)0;  /* completion is ignored */
+    uring_users[user].gen++;
+}
+
+/* set the events that io_uring waits for on this fd; helper for set_fd_events */
+static void set_fd_uring_events( struct fd *fd, int user, int events )
+{
+    if (user >= uring_nb_users)
+    {
+        unsigned int i, new_count = max( uring_nb_users * 2, 64 );
+        struct uring_user *new_users;
+
+        while (new_count <= user) new_count *= 2;
+        if (!(new_users = realloc( uring_users, new_count * sizeof(*uring_users) )))
+        {
+            uring_failed();
+            return;
+        }
+        for (i = uring_nb_users; i < new_count; i++)
+        {
+            new_users[i].gen = 0;
+            new_users[i].events = -1;
+        }
+        uring_users = new_users;
+        uring_nb_users = new_count;
+    }
+
+    if (events == -1)  /* stop waiting on this fd completely */
+    {
+        cancel_uring_poll( user );
+        return;
+    }
+    if (uring_users[user].events == events) return;  /* nothing to do */
+    if (uring_users[user].events != -1) cancel_uring_poll( user );
+    arm_uring_poll( user, fd->unix_fd, events );
+}
+
+static inline void init_uring(void)
+{
+    size_t sq_size, cq_size;
+
+    memset( &uring_params, 0, sizeof(uring_params) );
+    if ((uring_fd = syscall( __NR_io_uring_setup, 256, &uring_params )) == -1) return;
+    if (!(uring_params.features & IORING_FEAT_SINGLE_MMAP) ||
+        !(uring_params.features & IORING_FEAT_NODROP) ||
+        !(uring_params.features & IORING_FEAT_EXT_ARG))
+    {
+        /* kernel too old to be worth using over epoll */
+        uring_failed();
+        return;
+    }
+    sq_size = uring_params.sq_off.array + uring_params.sq_entries * sizeof(unsigned int);
+    cq_size = uring_params.cq_off.cqes + uring_params.cq_entries * sizeof(struct io_uring_cqe);
+    uring_ring_size = sq_size > cq_size ? sq_size : cq_size;
+    uring_ring_ptr = mmap( NULL, uring_ring_size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, uring_fd, IORING_OFF_SQ_RING );
+    if (uring_ring_ptr == MAP_FAILED)
+    {
+        uring_failed();
+        return;
+    }
+    uring_sqes = mmap( NULL, uring_params.sq_entries * sizeof(struct io_uring_sqe),
+                       PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring_fd, IORING_OFF_SQES );
+    if (uring_sqes == MAP_FAILED)
+    {
+        munmap( uring_ring_ptr, uring_ring_size );
+        uring_failed();
+        return;
+    }
+    uring_sq_head  = (unsigned int *)((char *)uring_ring_ptr + uring_params.sq_off.head);
+    uring_sq_tail  = (unsigned int *)((char *)uring_ring_ptr + uring_params.sq_off.tail);
+    uring_sq_mask  = (unsigned int *)((char *)uring_ring_ptr + uring_params.sq_off.ring_mask);
+    uring_sq_array = (unsigned int *)((char *)uring_ring_ptr + uring_params.sq_off.array);
+    uring_cq_head  = (unsigned int *)((char *)uring_ring_ptr + uring_params.cq_off.head);
+    uring_cq_tail  = (unsigned int *)((char *)uring_ring_ptr + uring_params.cq_off.tail);
+    uring_cq_mask  = (unsigned int *)((char *)uring_ring_ptr + uring_params.cq_off.ring_mask);
+    uring_cqes     = (struct io_uring_cqe *)((char *)uring_ring_ptr + uring_params.cq_off.cqes);
+}
+
+static inline void main_loop_uring(void)
+{
+    int users[256];
+    int i, count, ret, timeout;
+    unsigned int head, tail;
+
+    while (active_users)
+    {
+        timeout = get_next_timeout();
+
+        if (!active_users) break;  /* last user removed by a timeout */
+        if (uring_fd == -1) break;  /* an error occurred with io_uring */
+
+        ret = uring_enter( 1, timeout );
+        set_current_time();
+        if (ret == -1 && errno != EINTR && errno != ETIME)
+        {
+            uring_failed();
+            break;
+        }
+
+        /* put the events into the pollfd array first, like poll does */
+        count = 0;
+        head = *uring_cq_head;
+        tail = __atomic_load_n( uring_cq_tail, __ATOMIC_ACQUIRE );
+        while (head != tail && count < ARRAY_SIZE( users ))
+        {
+            const struct io_uring_cqe *cqe = &uring_cqes[head++ & *uring_cq_mask];
+            unsigned int user = cqe->user_data & 0xffffffff;
+            unsigned int gen = cqe->user_data >> 32;
+
+            /* drop stale completions of cancelled poll requests */
+            if (user >= uring_nb_users || gen != uring_users[user].gen) continue;
+            uring_users[user].events = -1;  /* poll requests are one-shot */
+            if (cqe->res == -ECANCELED) continue;
+            if (cqe->res >= 0) pollfd[user].revents = cqe->res & (POLLIN | POLLOUT | POLLERR | POLLHUP);
+            else pollfd[user].revents = POLLERR;
+            users[count++] = user;
+        }
+        __atomic_store_n( uring_cq_head, head, __ATOMIC_RELEASE );
+
+        /* read events from the pollfd array, as set_fd_events may modify them */
+        for (i = 0; i < count; i++)
+        {
+            int user = users[i];
+            if (pollfd[user].revents) fd_poll_event( poll_users[user], pollfd[user].revents );
+            pollfd[user].revents = 0;
+        }
+
+        /* re-arm the one-shot poll requests that are still wanted */
+        for (i = 0; i < count; i++)
+        {
+            int user = users[i];
+            if (uring_users[user].events == -1 && pollfd[user].fd != -1 && pollfd[user].events)
+                arm_uring_poll( user, pollfd[user].fd, pollfd[user].events );
+        }
+    }
+}
+
+#endif  /* HAVE_LINUX_IO_URING_H */
+
 static inline void init_epoll(void)
 {
+#ifdef USE_IO_URING
+    init_uring();
+    if (uring_fd != -1) return;
+#endif
     epoll_fd = epoll_create( 128 );
 }
 
@@ -557,6 +834,13 @@ static inline void set_fd_epoll_events( struct fd *fd, int user, int events )
     struct epoll_event ev;
     int ctl;
 
+#ifdef USE_IO_URING
+    if (uring_fd != -1)
+    {
+        set_fd_uring_events( fd, user, events );
+        return;
+    }
+#endif
     if (epoll_fd == -1) return;
 
     if (events == -1)  /* stop waiting on this fd completely */
@@ -591,6 +875,13 @@ static inline void set_fd_epoll_events( struct fd *fd, int user, int events )
 
 static inline void remove_epoll_user( struct fd *fd, int user )
 {
+#ifdef USE_IO_URING
+    if (uring_fd != -1)
+    {
+        cancel_uring_poll( user );
+        return;
+    }
+#endif
     if (epoll_fd == -1) return;
 
     if (pollfd[user].fd != -1)
@@ -610,6 +901,10 @@ static inline void main_loop_epoll(void)
     assert( POLLERR == EPOLLERR );
     assert( POLLHUP == EPOLLHUP );
 
+#ifdef USE_IO_URING
+    if (uring_fd != -1) main_loop_uring();
+    /* fall through to the epoll loop in case io_uring failed at runtime */
+#endif
     if (epoll_fd == -1) return;
 
     while (active_users)
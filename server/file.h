@@ -182,6 +182,10 @@ extern void free_mapped_views( struct process *process );
 extern int get_page_size(void);
 extern struct mapping *create_fd_mapping( struct object *root, const struct unicode_str *name, struct fd *fd,
                                           unsigned int attr, const struct security_descriptor *sd );
+extern struct shared_queue *queue_shm;
+extern struct mapping *create_shared_state_mapping( void **ptr );
+extern struct object *create_queue_state_mapping( struct object *root, const struct unicode_str *name,
+                                                  unsigned int attr, const struct security_descriptor *sd );
 extern struct object *create_user_data_mapping( struct object *root, const struct unicode_str *name,
                                                 unsigned int attr, const struct security_descriptor *sd );
 
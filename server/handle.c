@@ -42,7 +42,7 @@
 struct handle_entry
 {
     struct object *ptr;       /* object */
-    unsigned int   access;    /* access rights */
+    unsigned int   access;    /* access rights; holds the next free index when the entry is free */
 };
 
 struct handle_table
@@ -51,7 +51,7 @@ struct handle_table
     struct process      *process;     /* process owning this table */
     int                  count;       /* number of allocated entries */
     int                  last;        /* last used entry */
-    int                  free;        /* first entry that may be free */
+    int                  free;        /* head of the free entry list, or -1 */
     struct handle_entry *entries;     /* handle entries */
 };
 
@@ -208,7 +208,7 @@ struct handle_table *alloc_handle_table( struct process *process, int count )
     table->process = process;
     table->count   = count;
     table->last    = -1;
-    table->free    = 0;
+    table->free    = -1;
     if ((table->entries = mem_alloc( count * sizeof(*table->entries) ))) return table;
     release_object( table );
     return NULL;
@@ -234,18 +234,21 @@ static int grow_handle_table( struct handle_table *table )
 /* allocate the first free entry in the handle table */
 static obj_handle_t alloc_entry( struct handle_table *table, void *obj, unsigned int access )
 {
-    struct handle_entry *entry = table->entries + table->free;
+    struct handle_entry *entry;
     int i;
 
-    for (i = table->free; i <= table->last; i++, entry++) if (!entry->ptr) goto found;
-    if (i >= table->count)
+    if ((i = table->free) != -1)  /* pop an entry from the free list */
+    {
+        entry = table->entries + i;
+        table->free = (int)entry->access;
+    }
+    else  /* append past the last used entry */
     {
-        if (!grow_handle_table( table )) return 0;
-        entry = table->entries + i;  /* the entries may have moved */
+        i = table->last + 1;
+        if (i >= table->count && !grow_handle_table( table )) return 0;
+        entry = table->entries + i;
+        table->last = i;
     }
-    table->last = i;
- found:
-    table->free = i + 1;
     entry->ptr    = grab_object_for_handle( obj );
     entry->access = access;
     return index_to_handle(i);
@@ -337,6 +340,7 @@ static void shrink_handle_table( struct handle_table *table )
     struct handle_entry *entry = table->entries + table->last;
     struct handle_entry *new_entries;
     int count = table->count;
+    int i, prev;
 
     while (table->last >= 0)
     {
@@ -344,6 +348,18 @@ static void shrink_handle_table( struct handle_table *table )
         table->last--;
         entry--;
     }
+
+    /* drop the entries above the new last from the free list */
+    for (i = table->free, prev = -1; i != -1; i = (int)table->entries[i].access)
+    {
+        if (i > table->last)
+        {
+            if (prev == -1) table->free = (int)table->entries[i].access;
+            else table->entries[prev].access = table->entries[i].access;
+        }
+        else prev = i;
+    }
+
     if (table->last >= count / 4) return;  /* no need to shrink */
     if (count < MIN_HANDLE_ENTRIES * 2) return;  /* too small to shrink */
     count /= 2;
@@ -412,6 +428,15 @@ struct handle_table *copy_handle_table( struct process *process, struct process
             }
         }
     }
+    /* rebuild the free entry list */
+    table->free = -1;
+    for (i = table->last; i >= 0; i--)
+    {
+        if (table->entries[i].ptr) continue;
+        table->entries[i].access = table->free;
+        table->free = i;
+    }
+
     /* attempt to shrink the table */
     shrink_handle_table( table );
     return table;
@@ -430,8 +455,12 @@ unsigned int close_handle( struct process *process, obj_handle_t handle )
     if (!obj->ops->close_handle( obj, process, handle )) return STATUS_HANDLE_NOT_CLOSABLE;
     entry->ptr = NULL;
     table = handle_is_global(handle) ? global_table : process->handles;
-    if (entry < table->entries + table->free) table->free = entry - table->entries;
     if (entry == table->entries + table->last) shrink_handle_table( table );
+    else  /* push the entry onto the free list */
+    {
+        entry->access = table->free;
+        table->free = entry - table->entries;
+    }
     release_object_from_handle( obj );
     return STATUS_SUCCESS;
 }
@@ -235,5 +235,6 @@ int main( int argc, char *argv[] )
     init_directories( load_intl_file() );
     init_registry();
     main_loop();
+    dump_request_profile();
     return 0;
 }
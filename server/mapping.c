@@ -1109,6 +1109,44 @@ int get_page_size(void)
     return page_mask + 1;
 }
 
+struct shared_queue *queue_shm = NULL;
+
+/* create an anonymous shared mapping of one page, also mapped in the server */
+struct mapping *create_shared_state_mapping( void **ptr )
+{
+    static const struct unicode_str empty_name;
+    struct mapping *mapping;
+
+    if (!(mapping = create_mapping( NULL, &empty_name, 0, get_page_size(),
+                                    SEC_COMMIT, 0, FILE_READ_DATA | FILE_WRITE_DATA, NULL )))
+        return NULL;
+    *ptr = mmap( NULL, mapping->size, PROT_READ | PROT_WRITE, MAP_SHARED, get_unix_fd( mapping->fd ), 0 );
+    if (*ptr == MAP_FAILED)
+    {
+        release_object( mapping );
+        return NULL;
+    }
+    memset( *ptr, 0, mapping->size );
+    return mapping;
+}
+
+struct object *create_queue_state_mapping( struct object *root, const struct unicode_str *name,
+                                           unsigned int attr, const struct security_descriptor *sd )
+{
+    void *ptr;
+    struct mapping *mapping;
+
+    if (!(mapping = create_mapping( root, name, attr, get_page_size(),
+                                    SEC_COMMIT, 0, FILE_READ_DATA | FILE_WRITE_DATA, sd ))) return NULL;
+    ptr = mmap( NULL, mapping->size, PROT_READ | PROT_WRITE, MAP_SHARED, get_unix_fd( mapping->fd ), 0 );
+    if (ptr != MAP_FAILED)
+    {
+        queue_shm = ptr;
+        memset( queue_shm, 0, mapping->size );
+    }
+    return &mapping->obj;
+}
+
 struct object *create_user_data_mapping( struct object *root, const struct unicode_str *name,
                                         unsigned int attr, const struct security_descriptor *sd )
 {
@@ -240,6 +240,7 @@ extern unsigned short supported_machines[8];
 extern unsigned short native_machine;
 extern void init_registry(void);
 extern void flush_registry(void);
+extern int registry_reap_save_child( int pid, int status );
 
 static inline int is_machine_32bit( unsigned short machine )
 {
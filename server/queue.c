@@ -125,6 +125,8 @@ struct msg_queue
     unsigned int           wake_mask;       /* wakeup mask */
     unsigned int           changed_bits;    /* changed wakeup bits */
     unsigned int           changed_mask;    /* changed wakeup mask */
+    int                    shm_slot;        /* slot in the shared queue state page, or -1 */
+    unsigned int           shm_id;          /* id identifying the owner of the slot */
     int                    paint_count;     /* pending paint messages count */
     int                    hotkey_count;    /* pending hotkey messages count */
     int                    quit_message;    /* is there a pending quit message? */
@@ -161,6 +163,7 @@ static int msg_queue_signaled( struct object *obj, struct wait_queue_entry *entr
 static void msg_queue_satisfied( struct object *obj, struct wait_queue_entry *entry );
 static void msg_queue_destroy( struct object *obj );
 static void msg_queue_poll_event( struct fd *fd, int event );
+static void alloc_shared_queue( struct msg_queue *queue );
 static void thread_input_dump( struct object *obj, int verbose );
 static void thread_input_destroy( struct object *obj );
 static void timer_callback( void *private );
@@ -299,6 +302,7 @@ static struct msg_queue *create_msg_queue( struct thread *thread, struct thread_
         queue->wake_mask       = 0;
         queue->changed_bits    = 0;
         queue->changed_mask    = 0;
+        alloc_shared_queue( queue );
         queue->paint_count     = 0;
         queue->hotkey_count    = 0;
         queue->quit_message    = 0;
@@ -568,6 +572,44 @@ static inline int is_signaled( struct msg_queue *queue )
     return ((queue->wake_bits & queue->wake_mask) || (queue->changed_bits & queue->changed_mask));
 }
 
+/* assign a slot of the shared queue state page to a new queue */
+static void alloc_shared_queue( struct msg_queue *queue )
+{
+    static unsigned int next_id;
+    int i;
+
+    queue->shm_slot = -1;
+    queue->shm_id = 0;
+    if (!queue_shm) return;
+    for (i = 0; i < SHARED_QUEUE_SLOTS; i++)
+    {
+        if (queue_shm[i].id) continue;
+        if (!++next_id) ++next_id;  /* id 0 means a free slot */
+        queue_shm[i].wake_bits = 0;
+        queue_shm[i].changed_bits = 0;
+        queue_shm[i].id = next_id;
+        queue->shm_slot = i;
+        queue->shm_id = next_id;
+        break;
+    }
+}
+
+/* release the shared queue state slot of a queue */
+static void free_shared_queue( struct msg_queue *queue )
+{
+    if (queue->shm_slot == -1) return;
+    queue_shm[queue->shm_slot].id = 0;
+    queue->shm_slot = -1;
+}
+
+/* mirror the wake bits into the shared queue state page */
+static inline void sync_shared_queue_bits( struct msg_queue *queue )
+{
+    if (queue->shm_slot == -1) return;
+    queue_shm[queue->shm_slot].wake_bits = queue->wake_bits;
+    queue_shm[queue->shm_slot].changed_bits = queue->changed_bits;
+}
+
 /* set some queue bits */
 static inline void set_queue_bits( struct msg_queue *queue, unsigned int bits )
 {
@@ -578,6 +620,7 @@ static inline void set_queue_bits( struct msg_queue *queue, unsigned int bits )
     }
     queue->wake_bits |= bits;
     queue->changed_bits |= bits;
+    sync_shared_queue_bits( queue );
     if (is_signaled( queue )) wake_up( &queue->obj, 0 );
 }
 
@@ -586,6 +629,7 @@ static inline void clear_queue_bits( struct msg_queue *queue, unsigned int bits
 {
     queue->wake_bits &= ~bits;
     queue->changed_bits &= ~bits;
+    sync_shared_queue_bits( queue );
     if (!(queue->wake_bits & (QS_KEY | QS_MOUSEBUTTON)))
     {
         if (queue->keystate_lock) unlock_input_keystate( queue->input );
@@ -1138,6 +1182,7 @@ static void msg_queue_destroy( struct object *obj )
     struct hotkey *hotkey, *hotkey2;
     int i;
 
+    free_shared_queue( queue );
     cleanup_results( queue );
     for (i = 0; i < NB_MSG_KINDS; i++) empty_msg_list( &queue->msg_list[i] );
 
@@ -2493,7 +2538,13 @@ DECL_HANDLER(get_msg_queue)
     struct msg_queue *queue = get_current_queue();
 
     reply->handle = 0;
-    if (queue) reply->handle = alloc_handle( current->process, queue, SYNCHRONIZE, 0 );
+    reply->slot = -1;
+    if (queue)
+    {
+        reply->handle = alloc_handle( current->process, queue, SYNCHRONIZE, 0 );
+        reply->slot   = queue->shm_slot;
+        reply->shm_id = queue->shm_id;
+    }
 }
 
 
@@ -2552,6 +2603,7 @@ DECL_HANDLER(get_queue_status)
         reply->wake_bits    = queue->wake_bits;
         reply->changed_bits = queue->changed_bits;
         queue->changed_bits &= ~req->clear_bits;
+        sync_shared_queue_bits( queue );
     }
     else reply->wake_bits = reply->changed_bits = 0;
 }
@@ -2732,6 +2784,7 @@ DECL_HANDLER(get_message)
     }
     if (filter & QS_INPUT) queue->changed_bits &= ~QS_INPUT;
     if (filter & QS_PAINT) queue->changed_bits &= ~QS_PAINT;
+    sync_shared_queue_bits( queue );
 
     /* then check for posted messages */
     if ((filter & QS_POSTMESSAGE) &&
@@ -29,12 +29,15 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdarg.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 #include "ntstatus.h"
@@ -153,8 +156,12 @@ struct file_load_info
 {
     const char *filename; /* input file name */
     FILE       *file;     /* input file */
-    char       *buffer;   /* line buffer */
-    int         len;      /* buffer length */
+    char       *buffer;   /* current line */
+    char       *heap_buf; /* line buffer, used when the file is not mapped */
+    char       *data;     /* memory mapped file contents, or NULL */
+    size_t      data_size;/* size of the mapping */
+    size_t      data_pos; /* current read position in the mapping */
+    int         len;      /* heap buffer length */
     int         line;     /* current input line */
     WCHAR      *tmp;      /* temp buffer to use while parsing input */
     size_t      tmplen;   /* length of temp buffer */
@@ -1363,28 +1370,62 @@ static int read_next_line( struct file_load_info *info )
     int newlen, pos = 0;
 
     info->line++;
+
+    if (info->data)  /* read the line in place from the mapping */
+    {
+        char *start = info->data + info->data_pos, *end;
+        size_t remaining = info->data_size - info->data_pos;
+
+        if (!remaining) return 0;  /* EOF */
+        if ((end = memchr( start, '\n', remaining )))
+        {
+            info->data_pos += end + 1 - start;
+            *end = 0;
+            if (end > start && end[-1] == '\r') end[-1] = 0;
+            info->buffer = start;
+            return 1;
+        }
+        /* last line without a newline; copy it to guarantee a terminator */
+        if (remaining + 1 > (size_t)info->len)
+        {
+            if (!(newbuf = realloc( info->heap_buf, remaining + 1 )))
+            {
+                set_error( STATUS_NO_MEMORY );
+                return -1;
+            }
+            info->heap_buf = newbuf;
+            info->len = remaining + 1;
+        }
+        memcpy( info->heap_buf, start, remaining );
+        info->heap_buf[remaining] = 0;
+        info->data_pos = info->data_size;
+        info->buffer = info->heap_buf;
+        return 1;
+    }
+
+    info->buffer = info->heap_buf;
     for (;;)
     {
-        if (!fgets( info->buffer + pos, info->len - pos, info->file ))
+        if (!fgets( info->heap_buf + pos, info->len - pos, info->file ))
             return (pos != 0);  /* EOF */
-        pos = strlen(info->buffer);
-        if (info->buffer[pos-1] == '\n')
+        pos = strlen(info->heap_buf);
+        if (info->heap_buf[pos-1] == '\n')
         {
             /* got a full line */
-            info->buffer[--pos] = 0;
-            if (pos > 0 && info->buffer[pos-1] == '\r') info->buffer[pos-1] = 0;
+            info->heap_buf[--pos] = 0;
+            if (pos > 0 && info->heap_buf[pos-1] == '\r') info->heap_buf[pos-1] = 0;
             return 1;
         }
         if (pos < info->len - 1) return 1;  /* EOF but something was read */
 
         /* need to enlarge the buffer */
         newlen = info->len + info->len / 2;
-        if (!(newbuf = realloc( info->buffer, newlen )))
+        if (!(newbuf = realloc( info->heap_buf, newlen )))
         {
             set_error( STATUS_NO_MEMORY );
             return -1;
         }
-        info->buffer = newbuf;
+        info->buffer = info->heap_buf = newbuf;
         info->len = newlen;
     }
 }
@@ -1721,17 +1762,34 @@ static void load_keys( struct key *key, const char *filename, FILE *f, int prefi
     timeout_t modif = current_time;
     char *p;
 
+    struct stat st;
+
     info.filename = filename;
     info.file   = f;
     info.len    = 4;
     info.tmplen = 4;
     info.line   = 0;
-    if (!(info.buffer = mem_alloc( info.len ))) return;
+    info.data   = NULL;
+    info.data_size = info.data_pos = 0;
+    if (!(info.heap_buf = mem_alloc( info.len ))) return;
     if (!(info.tmp = mem_alloc( info.tmplen )))
     {
-        free( info.buffer );
+        free( info.heap_buf );
         return;
     }
+    info.buffer = info.heap_buf;
+
+    /* map the hives we load ourselves; the lines are then parsed in place
+     * instead of being copied through a growing buffer */
+    if (filename && !fstat( fileno( f ), &st ) && S_ISREG(st.st_mode) && st.st_size)
+    {
+        char *ptr = mmap( NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno( f ), 0 );
+        if (ptr != MAP_FAILED)
+        {
+            info.data = ptr;
+            info.data_size = st.st_size;
+        }
+    }
 
     if ((read_next_line( &info ) != 1) ||
         strcmp( info.buffer, "WINE REGISTRY Version 2" ))
@@ -1780,7 +1838,8 @@ static void load_keys( struct key *key, const char *filename, FILE *f, int prefi
         update_key_time( subkey, modif );
         release_object( subkey );
     }
-    free( info.buffer );
+    if (info.data) munmap( info.data, info.data_size );
+    free( info.heap_buf );
     free( info.tmp );
 }
 
@@ -2120,16 +2179,63 @@ done:
     return ret;
 }
 
+static pid_t save_child_pid;  /* pid of the forked child performing an asynchronous save */
+
+/* handle the exit of the forked registry save child */
+int registry_reap_save_child( int pid, int status )
+{
+    int i;
+
+    if (!save_child_pid || pid != save_child_pid) return 0;
+    save_child_pid = 0;
+    if (!WIFEXITED(status) || WEXITSTATUS(status))
+    {
+        /* the child failed to save; mark the branches dirty again so the
+         * next periodic save retries */
+        for (i = 0; i < save_branch_count; i++)
+            save_branch_info[i].key->flags |= KEY_DIRTY;
+    }
+    return 1;
+}
+
 /* periodic saving of the registry */
 static void periodic_save( void *arg )
 {
-    int i;
+    int i, dirty = 0;
+    pid_t pid;
 
-    if (fchdir( config_dir_fd ) == -1) return;
     save_timeout_user = NULL;
     for (i = 0; i < save_branch_count; i++)
-        save_branch( save_branch_info[i].key, save_branch_info[i].path );
-    if (fchdir( server_dir_fd ) == -1) fatal_error( "chdir to server dir: %s\n", strerror( errno ));
+        if (save_branch_info[i].key->flags & KEY_DIRTY) dirty = 1;
+
+    /* write the snapshot from a forked child so that request processing
+     * doesn't block on disk I/O; copy-on-write keeps the view consistent */
+    if (dirty && !save_child_pid)
+    {
+        if (!(pid = fork()))
+        {
+            /* don't let the inherited handlers write into the parent's signal pipe */
+            sigset_t all_sigs;
+            sigfillset( &all_sigs );
+            sigprocmask( SIG_BLOCK, &all_sigs, NULL );
+            if (fchdir( config_dir_fd ) == -1) _exit( 1 );
+            for (i = 0; i < save_branch_count; i++)
+                if (!save_branch( save_branch_info[i].key, save_branch_info[i].path )) _exit( 1 );
+            _exit( 0 );
+        }
+        if (pid != -1)
+        {
+            /* modifications from now on will be picked up by the next save */
+            save_child_pid = pid;
+            for (i = 0; i < save_branch_count; i++) make_clean( save_branch_info[i].key );
+        }
+        else if (fchdir( config_dir_fd ) != -1)  /* fork failed, save synchronously */
+        {
+            for (i = 0; i < save_branch_count; i++)
+                save_branch( save_branch_info[i].key, save_branch_info[i].path );
+            if (fchdir( server_dir_fd ) == -1) fatal_error( "chdir to server dir: %s\n", strerror( errno ));
+        }
+    }
     set_periodic_save_timer();
 }
 
@@ -2145,6 +2251,15 @@ void flush_registry(void)
 {
     int i;
 
+    if (save_child_pid)  /* let the asynchronous save finish first */
+    {
+        int status;
+        pid_t ret, pid = save_child_pid;
+
+        do ret = waitpid( pid, &status, 0 ); while (ret == -1 && errno == EINTR);
+        if (ret == pid) registry_reap_save_child( pid, status );
+        else save_child_pid = 0;
+    }
     if (fchdir( config_dir_fd ) == -1) return;
     for (i = 0; i < save_branch_count; i++)
     {
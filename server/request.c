@@ -33,12 +33,16 @@
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/time.h>
+#include <time.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/wait.h>
 #ifdef HAVE_SYS_UIO_H
 #include <sys/uio.h>
 #endif
+#ifdef HAVE_SYS_SYSCALL_H
+#include <sys/syscall.h>
+#endif
 #ifdef HAVE_SYS_UN_H
 #include <sys/un.h>
 #endif
@@ -246,11 +250,40 @@ void write_reply( struct thread *thread )
         fatal_protocol_error( thread, "reply write: %s\n", strerror( errno ));
 }
 
+/* try to send the reply through the thread's shared memory channel */
+static int send_reply_shm( union generic_reply *reply )
+{
+#if defined(__linux__) && defined(__NR_futex)
+    struct shared_reply *shm = current->reply_shm;
+    char *data = (char *)(shm + 1);
+    int waiting;
+
+    if (!shm) return 0;
+    /* the reply that sets up the channel still goes through the pipe */
+    if (current->req.request_header.req == REQ_get_shared_reply) return 0;
+    if (current->req.request_header.reply_size >
+        current->reply_shm_size - sizeof(*shm) - sizeof(*reply)) return 0;
+
+    memcpy( data, reply, sizeof(*reply) );
+    if (current->reply_size) memcpy( data + sizeof(*reply), current->reply_data, current->reply_size );
+    __atomic_store_n( &shm->sequence, shm->sequence + 1, __ATOMIC_RELEASE );
+    waiting = __atomic_exchange_n( &shm->waiting, 0, __ATOMIC_SEQ_CST );
+    if (waiting) syscall( __NR_futex, &shm->sequence, 1 /* FUTEX_WAKE */, 1, NULL, 0, 0 );
+    free( current->reply_data );
+    current->reply_data = NULL;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
 /* send a reply to the current thread */
 static void send_reply( union generic_reply *reply )
 {
     int ret;
 
+    if (send_reply_shm( reply )) return;
+
     if (!current->reply_size)
     {
         if ((ret = write( get_unix_fd( current->reply_fd ),
@@ -288,11 +321,48 @@ static void send_reply( union generic_reply *reply )
         fatal_protocol_error( current, "reply write: %s\n", strerror( errno ));
 }
 
+/* Request processing is strictly single-threaded: every object operation
+ * assumes exclusive access to the object namespace, the handle tables and
+ * the global lists, and 'current' is a single global.  Handing requests of
+ * independent processes to worker threads would require a lock hierarchy
+ * over all of these; until such a hierarchy exists, any parallelism has to
+ * come from cheaper per-request work instead (see the shared memory reply
+ * channel), not from concurrent handler execution. */
+
+/* per-request timing statistics, enabled by WINESERVER_PROFILE */
+static struct req_profile
+{
+    unsigned int     count;   /* number of calls */
+    unsigned __int64 total;   /* total handling time in ns */
+    unsigned __int64 max;     /* worst handling time in ns */
+} req_profile[REQ_NB_REQUESTS];
+
+static int profile_requests = -1;
+
+/* print the accumulated per-request statistics */
+void dump_request_profile(void)
+{
+    unsigned int i;
+
+    if (profile_requests != 1) return;
+    fprintf( stderr, "%-32s %10s %12s %10s %10s\n",
+             "request", "count", "total(us)", "avg(ns)", "max(ns)" );
+    for (i = 0; i < REQ_NB_REQUESTS; i++)
+    {
+        if (!req_profile[i].count) continue;
+        fprintf( stderr, "%-32s %10u %12u %10u %10u\n", get_request_name( i ),
+                 req_profile[i].count, (unsigned int)(req_profile[i].total / 1000),
+                 (unsigned int)(req_profile[i].total / req_profile[i].count),
+                 (unsigned int)req_profile[i].max );
+    }
+}
+
 /* call a request handler */
 static void call_req_handler( struct thread *thread )
 {
     union generic_reply reply;
     enum request req = thread->req.request_header.req;
+    struct timespec tv_start, tv_end;
 
     current = thread;
     current->reply_size = 0;
@@ -300,12 +370,25 @@ static void call_req_handler( struct thread *thread )
     memset( &reply, 0, sizeof(reply) );
 
     if (debug_level) trace_request();
+    if (profile_requests == -1) profile_requests = getenv( "WINESERVER_PROFILE" ) != NULL;
+    if (profile_requests) clock_gettime( CLOCK_MONOTONIC, &tv_start );
 
     if (req < REQ_NB_REQUESTS)
         req_handlers[req]( &current->req, &reply );
     else
         set_error( STATUS_NOT_IMPLEMENTED );
 
+    if (profile_requests && req < REQ_NB_REQUESTS)
+    {
+        unsigned __int64 ns;
+
+        clock_gettime( CLOCK_MONOTONIC, &tv_end );
+        ns = (tv_end.tv_sec - tv_start.tv_sec) * 1000000000ull + tv_end.tv_nsec - tv_start.tv_nsec;
+        req_profile[req].count++;
+        req_profile[req].total += ns;
+        if (ns > req_profile[req].max) req_profile[req].max = ns;
+    }
+
     if (current)
     {
         if (current->reply_fd)
@@ -29,6 +29,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#ifdef HAVE_SYS_SYSCALL_H
+#include <sys/syscall.h>
+#endif
 #include <unistd.h>
 #include <time.h>
 #include <poll.h>
@@ -237,6 +241,8 @@ static inline void init_thread_structure( struct thread *thread )
     thread->reply_towrite   = 0;
     thread->request_fd      = NULL;
     thread->reply_fd        = NULL;
+    thread->reply_shm       = NULL;
+    thread->reply_shm_size  = 0;
     thread->wait_fd         = NULL;
     thread->state           = RUNNING;
     thread->exit_code       = 0;
@@ -417,6 +423,7 @@ static void cleanup_thread( struct thread *thread )
     free( thread->reply_data );
     if (thread->request_fd) release_object( thread->request_fd );
     if (thread->reply_fd) release_object( thread->reply_fd );
+    if (thread->reply_shm) munmap( thread->reply_shm, thread->reply_shm_size );
     if (thread->wait_fd) release_object( thread->wait_fd );
     cleanup_clipboard_thread(thread);
     destroy_thread_windows( thread );
@@ -435,6 +442,8 @@ static void cleanup_thread( struct thread *thread )
     thread->reply_data = NULL;
     thread->request_fd = NULL;
     thread->reply_fd = NULL;
+    thread->reply_shm = NULL;
+    thread->reply_shm_size = 0;
     thread->wait_fd = NULL;
     thread->desktop = 0;
     thread->desc = NULL;
@@ -1451,6 +1460,41 @@ DECL_HANDLER(init_thread)
     reply->suspend = (current->suspend || current->process->suspend || current->context != NULL);
 }
 
+/* set up a shared memory reply channel for the current thread */
+DECL_HANDLER(get_shared_reply)
+{
+#if defined(__linux__) && defined(__NR_memfd_create)
+    void *ptr;
+    int fd;
+
+    if (current->reply_shm)
+    {
+        set_error( STATUS_INVALID_PARAMETER );
+        return;
+    }
+    if ((fd = syscall( __NR_memfd_create, "wine-reply", 1 /* MFD_CLOEXEC */ )) == -1)
+    {
+        file_set_error();
+        return;
+    }
+    if (ftruncate( fd, SHARED_REPLY_SIZE ) == -1 ||
+        (ptr = mmap( NULL, SHARED_REPLY_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 )) == MAP_FAILED)
+    {
+        file_set_error();
+        close( fd );
+        return;
+    }
+    memset( ptr, 0, SHARED_REPLY_SIZE );
+    current->reply_shm = ptr;
+    current->reply_shm_size = SHARED_REPLY_SIZE;
+    send_client_fd( current->process, fd, 0 );
+    close( fd );
+    reply->size = SHARED_REPLY_SIZE;
+#else
+    set_error( STATUS_NOT_SUPPORTED );
+#endif
+}
+
 /* terminate a thread */
 DECL_HANDLER(terminate_thread)
 {
@@ -69,6 +69,8 @@ struct thread
     unsigned int           reply_towrite; /* amount of data still to write in reply */
     struct fd             *request_fd;    /* fd for receiving client requests */
     struct fd             *reply_fd;      /* fd to send a reply to a client */
+    void                  *reply_shm;     /* shared memory reply channel */
+    data_size_t            reply_shm_size;/* size of the reply channel mapping */
     struct fd             *wait_fd;       /* fd to use to wake a sleeping client */
     enum run_state         state;         /* running state */
     int                    exit_code;     /* thread exit code */
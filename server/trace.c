@@ -1365,6 +1365,26 @@ static void dump_varargs_rawinput_devices(const char *prefix, data_size_t size )
     fputc( '}', stderr );
 }
 
+static void dump_varargs_completion_infos( const char *prefix, data_size_t size )
+{
+    const struct completion_info *info;
+
+    fprintf( stderr, "%s{", prefix );
+    while (size >= sizeof(*info))
+    {
+        info = cur_data;
+        fprintf( stderr, "{status=%s", get_status_name( info->status ));
+        dump_uint64( ",ckey=", &info->ckey );
+        dump_uint64( ",cvalue=", &info->cvalue );
+        dump_uint64( ",information=", &info->information );
+        fputc( '}', stderr );
+        size -= sizeof(*info);
+        remove_data( sizeof(*info) );
+        if (size) fputc( ',', stderr );
+    }
+    fputc( '}', stderr );
+}
+
 static void dump_varargs_handle_infos( const char *prefix, data_size_t size )
 {
     const struct handle_info *handle;
@@ -1497,6 +1517,15 @@ static void dump_init_thread_reply( const struct init_thread_reply *req )
     fprintf( stderr, " suspend=%d", req->suspend );
 }
 
+static void dump_get_shared_reply_request( const struct get_shared_reply_request *req )
+{
+}
+
+static void dump_get_shared_reply_reply( const struct get_shared_reply_reply *req )
+{
+    fprintf( stderr, " size=%u", req->size );
+}
+
 static void dump_terminate_process_request( const struct terminate_process_request *req )
 {
     fprintf( stderr, " handle=%04x", req->handle );
@@ -2642,6 +2671,8 @@ static void dump_get_msg_queue_request( const struct get_msg_queue_request *req
 static void dump_get_msg_queue_reply( const struct get_msg_queue_reply *req )
 {
     fprintf( stderr, " handle=%04x", req->handle );
+    fprintf( stderr, ", slot=%d", req->slot );
+    fprintf( stderr, ", shm_id=%08x", req->shm_id );
 }
 
 static void dump_set_queue_fd_request( const struct set_queue_fd_request *req )
@@ -3390,6 +3421,15 @@ static void dump_get_thread_desktop_reply( const struct get_thread_desktop_reply
     fprintf( stderr, " handle=%04x", req->handle );
 }
 
+static void dump_get_desktop_keystate_request( const struct get_desktop_keystate_request *req )
+{
+}
+
+static void dump_get_desktop_keystate_reply( const struct get_desktop_keystate_reply *req )
+{
+    fprintf( stderr, " handle=%04x", req->handle );
+}
+
 static void dump_set_thread_desktop_request( const struct set_thread_desktop_request *req )
 {
     fprintf( stderr, " handle=%04x", req->handle );
@@ -4335,6 +4375,7 @@ static void dump_remove_completion_reply( const struct remove_completion_reply *
     dump_uint64( ", cvalue=", &req->cvalue );
     dump_uint64( ", information=", &req->information );
     fprintf( stderr, ", status=%08x", req->status );
+    dump_varargs_completion_infos( ", data=", cur_size );
 }
 
 static void dump_query_completion_request( const struct query_completion_request *req )
@@ -4574,6 +4615,7 @@ static const dump_func req_dumpers[REQ_NB_REQUESTS] = {
     (dump_func)dump_init_process_done_request,
     (dump_func)dump_init_first_thread_request,
     (dump_func)dump_init_thread_request,
+    (dump_func)dump_get_shared_reply_request,
     (dump_func)dump_terminate_process_request,
     (dump_func)dump_terminate_thread_request,
     (dump_func)dump_get_process_info_request,
@@ -4742,6 +4784,7 @@ static const dump_func req_dumpers[REQ_NB_REQUESTS] = {
     (dump_func)dump_open_input_desktop_request,
     (dump_func)dump_close_desktop_request,
     (dump_func)dump_get_thread_desktop_request,
+    (dump_func)dump_get_desktop_keystate_request,
     (dump_func)dump_set_thread_desktop_request,
     (dump_func)dump_enum_desktop_request,
     (dump_func)dump_set_user_object_info_request,
@@ -4858,6 +4901,7 @@ static const dump_func reply_dumpers[REQ_NB_REQUESTS] = {
     (dump_func)dump_init_process_done_reply,
     (dump_func)dump_init_first_thread_reply,
     (dump_func)dump_init_thread_reply,
+    (dump_func)dump_get_shared_reply_reply,
     (dump_func)dump_terminate_process_reply,
     (dump_func)dump_terminate_thread_reply,
     (dump_func)dump_get_process_info_reply,
@@ -5026,6 +5070,7 @@ static const dump_func reply_dumpers[REQ_NB_REQUESTS] = {
     (dump_func)dump_open_input_desktop_reply,
     NULL,
     (dump_func)dump_get_thread_desktop_reply,
+    (dump_func)dump_get_desktop_keystate_reply,
     NULL,
     (dump_func)dump_enum_desktop_reply,
     (dump_func)dump_set_user_object_info_reply,
@@ -5142,6 +5187,7 @@ static const char * const req_names[REQ_NB_REQUESTS] = {
     "init_process_done",
     "init_first_thread",
     "init_thread",
+    "get_shared_reply",
     "terminate_process",
     "terminate_thread",
     "get_process_info",
@@ -5310,6 +5356,7 @@ static const char * const req_names[REQ_NB_REQUESTS] = {
     "open_input_desktop",
     "close_desktop",
     "get_thread_desktop",
+    "get_desktop_keystate",
     "set_thread_desktop",
     "enum_desktop",
     "set_user_object_info",
@@ -5651,3 +5698,9 @@ void trace_reply( enum request req, const union generic_reply *reply )
     else fprintf( stderr, "%04x: %d() = %s\n",
                   current->id, req, get_status_name(current->error) );
 }
+
+const char *get_request_name( int req )
+{
+    if (req >= 0 && req < REQ_NB_REQUESTS) return req_names[req];
+    return "unknown";
+}
@@ -76,7 +76,9 @@ struct desktop
     struct thread_input *foreground_input; /* thread input of foreground thread */
     unsigned int         users;            /* processes and threads using this desktop */
     struct global_cursor cursor;           /* global cursor information */
-    unsigned char        keystate[256];    /* asynchronous key state */
+    unsigned char       *keystate;         /* asynchronous key state (in the shared mapping when available) */
+    unsigned char        keystate_buf[256];/* fallback key state storage */
+    struct mapping      *keystate_map;     /* shared keystate mapping of this desktop */
 };
 
 /* user handles functions */
@@ -22,6 +22,7 @@
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 
 #include "ntstatus.h"
@@ -217,6 +218,27 @@ struct desktop *get_desktop_obj( struct process *process, obj_handle_t handle, u
     return (struct desktop *)get_handle_obj( process, handle, access, &desktop_ops );
 }
 
+/* create the private shared keystate mapping of a new desktop */
+static void alloc_shared_keystate( struct desktop *desktop )
+{
+    void *ptr;
+
+    desktop->keystate = desktop->keystate_buf;
+    memset( desktop->keystate_buf, 0, sizeof(desktop->keystate_buf) );
+    if (!(desktop->keystate_map = create_shared_state_mapping( &ptr ))) return;
+    desktop->keystate = ((struct shared_keystate *)ptr)->keystate;
+}
+
+/* release the shared keystate mapping of a desktop */
+static void free_shared_keystate( struct desktop *desktop )
+{
+    if (!desktop->keystate_map) return;
+    munmap( desktop->keystate, get_page_size() );
+    release_object( desktop->keystate_map );
+    desktop->keystate_map = NULL;
+    desktop->keystate = desktop->keystate_buf;
+}
+
 /* create a desktop object */
 static struct desktop *create_desktop( const struct unicode_str *name, unsigned int attr,
                                        unsigned int flags, struct winstation *winstation )
@@ -237,7 +259,7 @@ static struct desktop *create_desktop( const struct unicode_str *name, unsigned
             desktop->foreground_input = NULL;
             desktop->users = 0;
             memset( &desktop->cursor, 0, sizeof(desktop->cursor) );
-            memset( desktop->keystate, 0, sizeof(desktop->keystate) );
+            alloc_shared_keystate( desktop );
             list_add_tail( &winstation->desktops, &desktop->entry );
             list_init( &desktop->hotkeys );
         }
@@ -291,6 +313,7 @@ static void desktop_destroy( struct object *obj )
 {
     struct desktop *desktop = (struct desktop *)obj;
 
+    free_shared_keystate( desktop );
     free_hotkeys( desktop, 0 );
     if (desktop->top_window) free_window_handle( desktop->top_window );
     if (desktop->msg_window) free_window_handle( desktop->msg_window );
@@ -609,6 +632,20 @@ DECL_HANDLER(get_thread_desktop)
 }
 
 
+/* get a read-only handle to the shared keystate mapping of the thread's desktop */
+DECL_HANDLER(get_desktop_keystate)
+{
+    struct desktop *desktop;
+
+    if (!(desktop = get_thread_desktop( current, 0 ))) return;
+    if (desktop->keystate_map)
+        reply->handle = alloc_handle( current->process, desktop->keystate_map,
+                                      STANDARD_RIGHTS_READ | SECTION_QUERY | SECTION_MAP_READ, 0 );
+    else
+        set_error( STATUS_NOT_SUPPORTED );
+    release_object( desktop );
+}
+
 /* set the thread current desktop */
 DECL_HANDLER(set_thread_desktop)
 {